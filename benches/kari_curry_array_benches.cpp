@@ -0,0 +1,71 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/BlackMATov/kari.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2017-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <kari.hpp/kari_curry_array.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using namespace kari_hpp;
+using namespace kari_hpp::ext;
+using namespace kari_hpp::ext::underscore;
+
+namespace
+{
+    constexpr int rule_count = 4096;
+    constexpr int iterations = 10'000;
+
+    volatile unsigned sink{};
+
+    template < typename F >
+    double measure_ns(F&& f) {
+        const auto start = std::chrono::steady_clock::now();
+        for ( int i = 0; i < iterations; ++i ) {
+            sink = f(i % rule_count);
+        }
+        const auto finish = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(finish - start).count()
+            / static_cast<double>(iterations)
+            / static_cast<double>(rule_count);
+    }
+
+    template < typename F >
+    void bench(const char* name, F&& f) {
+        std::printf("%-40s %8.3f ns/rule\n", name, measure_ns(f));
+    }
+}
+
+int main() {
+    std::vector<decltype(_ < 0)> rule_vector;
+    curry_array<decltype(_ < 0)> rule_array;
+
+    for ( int i = 0; i < rule_count; ++i ) {
+        rule_vector.push_back(_ < i);
+        rule_array.push_back(_ < i);
+    }
+
+    std::vector<unsigned char> results(rule_count);
+    std::vector<std::uint64_t> mask(rule_count / 64);
+
+    bench("std::vector<curry_t> loop", [&](int v){
+        for ( std::size_t i = 0; i < rule_vector.size(); ++i ) {
+            results[i] = rule_vector[i](v);
+        }
+        return results[0];
+    });
+
+    bench("curry_array::eval", [&](int v){
+        rule_array.eval(results.data(), v);
+        return results[0];
+    });
+
+    bench("curry_array::eval_mask", [&](int v){
+        rule_array.eval_mask(mask.data(), v);
+        return static_cast<unsigned>(mask[0]);
+    });
+}
@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/BlackMATov/kari.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2017-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <kari.hpp/kari.hpp>
+
+#include <chrono>
+#include <cstdio>
+
+using namespace kari_hpp;
+using namespace kari_hpp::ext;
+using namespace kari_hpp::ext::underscore;
+
+namespace
+{
+    constexpr int iterations = 10'000'000;
+
+    volatile int sink{};
+
+    int add3(int a, int b, int c) {
+        return a + b + c;
+    }
+
+    template < typename F >
+    double measure_ns(F&& f) {
+        const auto start = std::chrono::steady_clock::now();
+        for ( int i = 0; i < iterations; ++i ) {
+            sink = f(i);
+        }
+        const auto finish = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(finish - start).count() / iterations;
+    }
+
+    template < typename F >
+    void bench(const char* name, double baseline_ns, F&& f) {
+        const double ns = measure_ns(f);
+        std::printf("%-28s %8.2f ns/op %8.2fx\n", name, ns, ns / baseline_ns);
+    }
+}
+
+int main() {
+    std::printf("KARI_HPP_FORCE_INLINE=%d\n", KARI_HPP_FORCE_INLINE);
+
+    const double baseline_ns = measure_ns([](int i){
+        return add3(i, 1, 2);
+    });
+
+    bench("add3(a, b, c)", baseline_ns, [](int i){
+        return add3(i, 1, 2);
+    });
+
+    bench("curry(add3)(a)(b)(c)", baseline_ns, [](int i){
+        return curry(add3)(i)(1)(2);
+    });
+
+    bench("curry(add3)(a, b, c)", baseline_ns, [](int i){
+        return curry(add3)(i, 1, 2);
+    });
+
+    bench("curry(add3, a)(b, c)", baseline_ns, [](int i){
+        return curry(add3, i)(1, 2);
+    });
+
+    bench("(_ + 1)(a)", baseline_ns, [](int i){
+        return (_ + 1)(i);
+    });
+
+    bench("a | (_ + 1) | (_ * 2)", baseline_ns, [](int i){
+        return i | (_ + 1) | (_ * 2);
+    });
+}
@@ -0,0 +1,78 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/BlackMATov/kari.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2017-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <kari.hpp/kari_ranges.hpp>
+
+#include <chrono>
+#include <cstdio>
+
+#if defined(__cpp_lib_ranges)
+
+#include <numeric>
+#include <vector>
+
+using namespace kari_hpp;
+using namespace kari_hpp::ext;
+using namespace kari_hpp::ext::underscore;
+
+namespace
+{
+    constexpr int iterations = 100;
+
+    volatile long long sink{};
+
+    template < typename F >
+    double measure_ns(const std::vector<int>& v, F&& f) {
+        const auto start = std::chrono::steady_clock::now();
+        for ( int i = 0; i < iterations; ++i ) {
+            long long sum = 0;
+            for ( int x : f(v) ) {
+                sum += x;
+            }
+            sink = sum;
+        }
+        const auto finish = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(finish - start).count()
+            / static_cast<double>(iterations)
+            / static_cast<double>(v.size());
+    }
+
+    template < typename F >
+    void bench(const char* name, const std::vector<int>& v, F&& f) {
+        std::printf("%-48s %8.3f ns/element\n", name, measure_ns(v, f));
+    }
+}
+
+int main() {
+    std::vector<int> v(1'000'000);
+    std::iota(v.begin(), v.end(), 0);
+
+    bench("std::views::transform([](int x){ return x * 2; })", v, [](const auto& r){
+        return r | std::views::transform([](int x){ return x * 2; });
+    });
+
+    bench("map(_ * 2)", v, [](const auto& r){
+        return r | map(_ * 2);
+    });
+
+    bench("transform | filter (lambdas)", v, [](const auto& r){
+        return r
+            | std::views::transform([](int x){ return x * 2; })
+            | std::views::filter([](int x){ return x > 10; });
+    });
+
+    bench("map(_ * 2) | filter(_ > 10)", v, [](const auto& r){
+        return r | map(_ * 2) | filter(_ > 10);
+    });
+}
+
+#else
+
+int main() {
+    std::puts("std::ranges is not available");
+}
+
+#endif
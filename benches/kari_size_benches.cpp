@@ -0,0 +1,67 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/BlackMATov/kari.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2017-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <kari.hpp/kari.hpp>
+
+#include <cstdio>
+#include <tuple>
+
+using namespace kari_hpp;
+
+//
+// Binds every combination of the argument types below as the prefixes
+// of a few functions, the size report compares the code of kari_hpp
+// symbols with and without KARI_HPP_NORMALIZE_ARGS.
+//
+
+namespace
+{
+    volatile int sink{};
+
+    using arg_types = std::tuple<
+        char, signed char, unsigned char,
+        short, unsigned short,
+        int, unsigned,
+        long, long long>;
+
+    int add3(int a, int b, int c) {
+        return a + b + c;
+    }
+
+    long mul3(long a, long b, long c) {
+        return a * b * c;
+    }
+
+    const auto sub3 = [](int a, int b, int c){
+        return a - b - c;
+    };
+
+    template < typename A, typename B, typename F >
+    void bind_prefix(const F& f) {
+        const auto c = curry(f, static_cast<A>(sink), static_cast<B>(sink));
+        sink = static_cast<int>(c(sink));
+    }
+
+    template < typename A, typename F, typename... Bs >
+    void bind_prefixes(const F& f, std::tuple<Bs...>*) {
+        (bind_prefix<A, Bs>(f), ...);
+    }
+
+    template < typename F, typename... As >
+    void bind_all_prefixes(const F& f, std::tuple<As...>*) {
+        (bind_prefixes<As>(f, static_cast<arg_types*>(nullptr)), ...);
+    }
+}
+
+int main() {
+    std::printf("KARI_HPP_NORMALIZE_ARGS=%d\n", KARI_HPP_NORMALIZE_ARGS);
+
+    bind_all_prefixes(add3, static_cast<arg_types*>(nullptr));
+    bind_all_prefixes(mul3, static_cast<arg_types*>(nullptr));
+    bind_all_prefixes(sub3, static_cast<arg_types*>(nullptr));
+
+    std::printf("%d\n", sink);
+}
@@ -0,0 +1,131 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/BlackMATov/kari.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2017-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <kari.hpp/kari_sort.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace kari_hpp;
+using namespace kari_hpp::ext;
+using namespace kari_hpp::ext::underscore;
+
+namespace
+{
+    constexpr std::size_t record_count = 100'000;
+    constexpr int iterations = 10;
+
+    volatile int sink{};
+
+    struct record final {
+        std::string name;
+        int age;
+        double payload[4];
+    };
+
+    // a few hashed characters, an allocating copy and a cheap member
+    // are the typical costs of projections
+
+    std::uint64_t name_hash(const record& r) {
+        std::uint64_t h = 14695981039346656037u;
+        for ( const char c : r.name ) {
+            h = (h ^ static_cast<unsigned char>(c)) * 1099511628211u;
+        }
+        return h;
+    }
+
+    std::string lower_name(const record& r) {
+        std::string s = r.name;
+        for ( char& c : s ) {
+            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+        return s;
+    }
+
+    int age_of(const record& r) {
+        return r.age;
+    }
+
+    std::vector<record> make_records() {
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<int> letter('A', 'z');
+        std::uniform_int_distribution<int> age(0, 99);
+
+        std::vector<record> records(record_count);
+        for ( record& r : records ) {
+            r.name.resize(24);
+            for ( char& c : r.name ) {
+                c = static_cast<char>(letter(rng));
+            }
+            r.age = age(rng);
+        }
+        return records;
+    }
+
+    template < typename F >
+    double measure_ns(const std::vector<record>& source, F&& f) {
+        std::vector<record> work;
+        double total = 0.0;
+        for ( int i = 0; i < iterations; ++i ) {
+            work = source;
+            const auto start = std::chrono::steady_clock::now();
+            f(work);
+            const auto finish = std::chrono::steady_clock::now();
+            total += std::chrono::duration<double, std::nano>(finish - start).count();
+            sink = work.front().age;
+        }
+        return total
+            / static_cast<double>(iterations)
+            / static_cast<double>(source.size());
+    }
+
+    template < typename F >
+    void bench(const char* name, const std::vector<record>& source, F&& f) {
+        std::printf("%-40s %8.2f ns/record\n", name, measure_ns(source, f));
+    }
+
+    template < typename P >
+    void bench_sort(const char* name, const std::vector<record>& source, P proj) {
+        std::printf("-- sort by %s\n", name);
+
+        bench("std::sort, projecting lambda", source, [proj](std::vector<record>& v){
+            std::sort(v.begin(), v.end(), [proj](const record& l, const record& r){
+                return proj(l) < proj(r);
+            });
+        });
+
+        bench("fsort_by", source, [proj](std::vector<record>& v){
+            fsort_by(curry(proj), _ < _, std::ref(v));
+        });
+    }
+}
+
+int main() {
+    const std::vector<record> source = make_records();
+
+    bench_sort("lower_name", source, lower_name);
+    bench_sort("name_hash", source, name_hash);
+    bench_sort("age_of", source, age_of);
+
+    std::printf("-- partition by name_hash\n");
+
+    bench("std::stable_partition, projecting lambda", source, [](std::vector<record>& v){
+        std::stable_partition(v.begin(), v.end(), [](const record& r){
+            return name_hash(r) % 3 == 0;
+        });
+    });
+
+    bench("fpartition_by", source, [](std::vector<record>& v){
+        fpartition_by(curry(name_hash) | (_ % 3), _ == 0, std::ref(v));
+    });
+}
@@ -0,0 +1,48 @@
+#
+# Prints the size of code in kari_hpp symbols of the given binaries.
+#
+# cmake -DKARI_HPP_NM=<nm> [-DKARI_HPP_BLOATY=<bloaty>]
+#       -DKARI_HPP_BINARIES=<binary>[;<binary>...]
+#       -P kari_size_report.cmake
+#
+
+if(NOT KARI_HPP_NM)
+    message(FATAL_ERROR "KARI_HPP_NM is not set")
+endif()
+
+foreach(KARI_HPP_BINARY ${KARI_HPP_BINARIES})
+    execute_process(
+        COMMAND ${KARI_HPP_NM} --demangle --print-size --size-sort ${KARI_HPP_BINARY}
+        OUTPUT_VARIABLE KARI_HPP_NM_OUTPUT
+        RESULT_VARIABLE KARI_HPP_NM_RESULT)
+
+    if(NOT KARI_HPP_NM_RESULT EQUAL 0)
+        message(FATAL_ERROR "${KARI_HPP_NM} failed for ${KARI_HPP_BINARY}")
+    endif()
+
+    string(REPLACE ";" "\\;" KARI_HPP_NM_OUTPUT "${KARI_HPP_NM_OUTPUT}")
+    string(REPLACE "\n" ";" KARI_HPP_NM_LINES "${KARI_HPP_NM_OUTPUT}")
+
+    set(KARI_HPP_SYMBOLS 0)
+    set(KARI_HPP_TEXT_SIZE 0)
+
+    foreach(KARI_HPP_LINE IN LISTS KARI_HPP_NM_LINES)
+        # <address> <size> <type> <name>, code symbols only
+        if(KARI_HPP_LINE MATCHES "^[0-9a-fA-F]+ ([0-9a-fA-F]+) [tTwW] (.*)$")
+            set(KARI_HPP_SYMBOL_SIZE ${CMAKE_MATCH_1})
+            if(CMAKE_MATCH_2 MATCHES "kari_hpp::")
+                math(EXPR KARI_HPP_TEXT_SIZE "${KARI_HPP_TEXT_SIZE} + 0x${KARI_HPP_SYMBOL_SIZE}")
+                math(EXPR KARI_HPP_SYMBOLS "${KARI_HPP_SYMBOLS} + 1")
+            endif()
+        endif()
+    endforeach()
+
+    get_filename_component(KARI_HPP_BINARY_NAME ${KARI_HPP_BINARY} NAME)
+    message("${KARI_HPP_BINARY_NAME}: ${KARI_HPP_SYMBOLS} kari_hpp symbols, ${KARI_HPP_TEXT_SIZE} bytes of code")
+
+    if(KARI_HPP_BLOATY)
+        execute_process(
+            COMMAND ${KARI_HPP_BLOATY} -d symbols --demangle=full -n 20
+                    --source-filter=kari_hpp ${KARI_HPP_BINARY})
+    endif()
+endforeach()
@@ -6,11 +6,59 @@
 
 #pragma once
 
+#include <array>
+#include <cassert>
+#include <cstddef>
 #include <functional>
+#include <iterator>
+#include <limits>
+#include <optional>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 
+//
+// KARI_HPP_FORCE_INLINE
+//
+// Define KARI_HPP_FORCE_INLINE=1 to force inlining of the currying machinery
+// in debug (-O0, -Og) builds. The inlined functions are marked as artificial,
+// so debuggers step over them straight into the curried functions.
+//
+
+#if defined(KARI_HPP_FORCE_INLINE) && KARI_HPP_FORCE_INLINE
+#   if defined(__GNUC__) || defined(__clang__)
+#       if __has_attribute(artificial)
+#           define KARI_HPP_INLINE __attribute__((always_inline, artificial))
+#       else
+#           define KARI_HPP_INLINE __attribute__((always_inline))
+#       endif
+#   elif defined(_MSC_VER)
+#       define KARI_HPP_INLINE __forceinline
+#   else
+#       define KARI_HPP_INLINE
+#   endif
+#else
+#   define KARI_HPP_INLINE
+#endif
+
+//
+// KARI_HPP_NORMALIZE_ARGS
+//
+// Define KARI_HPP_NORMALIZE_ARGS=1 to store bound scalar arguments as the
+// scalar parameter types of the curried function, when the function has
+// a single non-template call operator. So `f(short(1))` and `f(1)` of
+// `void f(int, int)` are the same curry_t<F, int> type and share their
+// code. Define it for the whole program, it changes the curried types.
+//
+
+#if !defined(KARI_HPP_NORMALIZE_ARGS)
+#   define KARI_HPP_NORMALIZE_ARGS 0
+#endif
+
+// std::move and std::forward are real calls in debug builds
+#define KARI_HPP_MOVE(x) static_cast<std::remove_reference_t<decltype(x)>&&>(x)
+#define KARI_HPP_FWD(x) static_cast<decltype(x)&&>(x)
+
 namespace kari_hpp
 {
     template < typename F, typename... As >
@@ -37,14 +85,299 @@ namespace kari_hpp
 
 namespace kari_hpp::detail
 {
+    struct curry_access;
+}
+
+namespace kari_hpp::detail
+{
+    //
+    // unwrap_ref_decay_t
+    //
+
+    template < typename T >
+    struct unwrap_reference_impl {
+        using type = T;
+    };
+
+    template < typename T >
+    struct unwrap_reference_impl<std::reference_wrapper<T>> {
+        using type = T&;
+    };
+
+    template < typename T >
+    using unwrap_ref_decay_t = typename unwrap_reference_impl<std::decay_t<T>>::type;
+
+    //
+    // is_equality_comparable
+    //
+
+    template < typename T, typename = void >
+    struct is_equality_comparable
+    : std::false_type {};
+
+    template < typename T >
+    struct is_equality_comparable<T, std::void_t<
+        decltype(static_cast<bool>(std::declval<const T&>() == std::declval<const T&>()))>>
+    : std::true_type {};
+
+    //
+    // curry_arg_type_t
+    //
+    // The type of the I-th bound argument of F constructed from A.
+    //
+
+    template < typename F, typename = void >
+    struct callable_params {};
+
+    template < typename R, typename... Ps >
+    struct callable_params<R(*)(Ps...)> {
+        using type = std::tuple<Ps...>;
+    };
+
+    template < typename R, typename... Ps >
+    struct callable_params<R(*)(Ps...) noexcept> {
+        using type = std::tuple<Ps...>;
+    };
+
+    template < typename M >
+    struct member_callable_params {};
+
+    template < typename R, typename C, typename... Ps >
+    struct member_callable_params<R(C::*)(Ps...)> {
+        using type = std::tuple<Ps...>;
+    };
+
+    template < typename R, typename C, typename... Ps >
+    struct member_callable_params<R(C::*)(Ps...) const> {
+        using type = std::tuple<Ps...>;
+    };
+
+    template < typename R, typename C, typename... Ps >
+    struct member_callable_params<R(C::*)(Ps...) noexcept> {
+        using type = std::tuple<Ps...>;
+    };
+
+    template < typename R, typename C, typename... Ps >
+    struct member_callable_params<R(C::*)(Ps...) const noexcept> {
+        using type = std::tuple<Ps...>;
+    };
+
+    template < typename F >
+    struct callable_params<F, std::void_t<decltype(&F::operator())>>
+    : member_callable_params<decltype(&F::operator())> {};
+
+    template < typename F, std::size_t I, typename A, typename = void >
+    struct normalized_arg_type {
+        using type = unwrap_ref_decay_t<A>;
+    };
+
+    template < typename F, std::size_t I, typename A >
+    struct normalized_arg_type<F, I, A, std::enable_if_t<
+        (I < std::tuple_size_v<typename callable_params<F>::type>)>>
+    {
+        using param_type = std::tuple_element_t<I, typename callable_params<F>::type>;
+        using arg_type = unwrap_ref_decay_t<A>;
+
+        // only by-value scalar parameters, converting them earlier is not observable
+        using type = std::conditional_t<
+            std::is_scalar_v<param_type> &&
+            std::is_scalar_v<arg_type> &&
+            std::is_convertible_v<arg_type, param_type>,
+            param_type,
+            arg_type>;
+    };
+
+#if KARI_HPP_NORMALIZE_ARGS
+    template < typename F, std::size_t I, typename A >
+    using curry_value_arg_type_t = typename normalized_arg_type<F, I, A>::type;
+#else
+    template < typename F, std::size_t I, typename A >
+    using curry_value_arg_type_t = unwrap_ref_decay_t<A>;
+#endif
+
+    // functions can take their last argument from lvalues by reference,
+    // binding it saturates them, so the reference never outlives the call
+    template < typename F, std::size_t I >
+    struct is_bound_by_reference
+    : std::false_type {};
+
+    template < typename F, std::size_t I, typename A >
+    using curry_arg_type_t = std::conditional_t<
+        is_bound_by_reference<F, I>::value && std::is_lvalue_reference_v<A>,
+        A,
+        curry_value_arg_type_t<F, I, A>>;
+
+    //
+    // curry_args_t
+    //
+    // Aggregate storage for bound arguments. Unlike std::tuple it has only
+    // implicit special members, so it is trivially copyable whenever all
+    // of the bound arguments are.
+    //
+
+    template < std::size_t I, typename A >
+    struct curry_arg_t {
+        A value;
+    };
+
+    template < typename Is, typename... As >
+    struct curry_args_impl;
+
+    template < std::size_t... Is, typename... As >
+    struct curry_args_impl<std::index_sequence<Is...>, As...>
+    : curry_arg_t<Is, As>... {};
+
+    template < typename... As >
+    using curry_args_t = curry_args_impl<std::index_sequence_for<As...>, As...>;
+
+    template < std::size_t I, typename A >
+    KARI_HPP_INLINE constexpr A&& get_curry_arg(curry_arg_t<I, A>&& arg) noexcept {
+        return static_cast<A&&>(arg.value);
+    }
+
+    template < std::size_t I, typename A >
+    KARI_HPP_INLINE constexpr const A& get_curry_arg(const curry_arg_t<I, A>& arg) noexcept {
+        return arg.value;
+    }
+
+    template < typename... As >
+    inline constexpr bool is_nothrow_move_constructible_all_v =
+        std::conjunction_v<std::is_nothrow_move_constructible<As>...>;
+
+    template < typename... As >
+    inline constexpr bool is_nothrow_copy_constructible_all_v =
+        std::conjunction_v<std::is_nothrow_copy_constructible<As>...>;
+
+    template < std::size_t... Is, typename... As >
+    constexpr curry_args_t<As...> make_curry_args(
+        std::index_sequence<Is...>,
+        std::tuple<As...>&& args)
+    {
+        return {{std::get<Is>(KARI_HPP_MOVE(args))}...};
+    }
+
+    template < typename T, std::size_t... Is, typename... As, typename A >
+    KARI_HPP_INLINE constexpr curry_args_t<As..., T> append_curry_arg(
+        curry_args_impl<std::index_sequence<Is...>, As...>&& args,
+        A&& a)
+    noexcept(
+        is_nothrow_move_constructible_all_v<As...> &&
+        std::is_nothrow_constructible_v<T, A>)
+    {
+        return {
+            {get_curry_arg<Is>(KARI_HPP_MOVE(args))}...,
+            {static_cast<T>(KARI_HPP_FWD(a))}};
+    }
+
+    //
+    // curry_or_apply
+    //
+
     template < typename F, typename... Args >
-    constexpr auto curry_or_apply(F&& f, std::tuple<Args...>&& args) {
+    struct is_nothrow_curry_or_apply
+    : std::conditional_t<
+        std::is_invocable_v<F, Args...>,
+        std::is_nothrow_invocable<F, Args...>,
+        std::conjunction<
+            std::is_nothrow_move_constructible<F>,
+            std::is_nothrow_move_constructible<Args>...>> {};
+
+    template < typename F, typename... Args >
+    inline constexpr bool is_nothrow_curry_or_apply_v = is_nothrow_curry_or_apply<F, Args...>::value;
+
+    template < typename F, std::size_t... Is, typename... Args >
+    KARI_HPP_INLINE constexpr auto curry_or_apply(
+        F&& f,
+        curry_args_impl<std::index_sequence<Is...>, Args...>&& args)
+    noexcept(is_nothrow_curry_or_apply_v<std::decay_t<F>, Args...>)
+    {
         if constexpr ( std::is_invocable_v<std::decay_t<F>, Args...> ) {
-            return std::apply(std::forward<F>(f), std::move(args));
+            if constexpr ( std::is_member_pointer_v<std::decay_t<F>> ) {
+                return std::apply(
+                    KARI_HPP_FWD(f),
+                    std::forward_as_tuple(get_curry_arg<Is>(KARI_HPP_MOVE(args))...));
+            } else {
+                // direct call instead of std::apply and std::invoke layers,
+                // it is noticeably cheaper in debug builds
+                return KARI_HPP_FWD(f)(get_curry_arg<Is>(KARI_HPP_MOVE(args))...);
+            }
         } else {
-            return curry_t(std::forward<F>(f), std::move(args));
+            return curry_t<std::decay_t<F>, Args...>(
+                KARI_HPP_FWD(f),
+                KARI_HPP_MOVE(args));
         }
     }
+
+    //
+    // has_value_or_cref_params
+    //
+    // Function pointers and function objects with a single non-template
+    // call operator whose parameters are taken by value or by const
+    // reference. Such functions are called the same way whether their
+    // arguments are const lvalues or rvalues.
+    //
+
+    template < typename P >
+    inline constexpr bool is_value_or_cref_param_v =
+        !std::is_reference_v<P> ||
+        (std::is_lvalue_reference_v<P> && std::is_const_v<std::remove_reference_t<P>>);
+
+    template < typename... Ps >
+    using are_value_or_cref_params = std::bool_constant<(... && is_value_or_cref_param_v<Ps>)>;
+
+    template < typename M >
+    struct has_value_or_cref_call_operator_params : std::false_type {};
+
+    template < typename C, typename R, typename... Ps >
+    struct has_value_or_cref_call_operator_params<R(C::*)(Ps...) const>
+    : are_value_or_cref_params<Ps...> {};
+
+    template < typename C, typename R, typename... Ps >
+    struct has_value_or_cref_call_operator_params<R(C::*)(Ps...) const noexcept>
+    : are_value_or_cref_params<Ps...> {};
+
+    template < typename F, typename = void >
+    struct has_value_or_cref_params : std::false_type {};
+
+    template < typename R, typename... Ps >
+    struct has_value_or_cref_params<R(*)(Ps...)> : are_value_or_cref_params<Ps...> {};
+
+    template < typename R, typename... Ps >
+    struct has_value_or_cref_params<R(*)(Ps...) noexcept> : are_value_or_cref_params<Ps...> {};
+
+    template < typename F >
+    struct has_value_or_cref_params<F, std::enable_if_t<
+        std::is_class_v<F>,
+        std::void_t<decltype(&F::operator())>>>
+    : has_value_or_cref_call_operator_params<decltype(&F::operator())> {};
+
+    //
+    // apply_curry_args
+    //
+    // Calls a const function with const bound arguments and one more
+    // argument. A reused partial closure takes this path when the argument
+    // saturates it, so the bound arguments are not copied on every call.
+    // Only functions that can't tell const lvalues from rvalues take it,
+    // others still get a copy of the closure and rvalue arguments.
+    //
+
+    template < typename F, typename A, typename... Args >
+    inline constexpr bool is_curry_args_appliable_v = std::conjunction_v<
+        std::negation<std::is_member_pointer<F>>,
+        std::is_same<unwrap_ref_decay_t<A>, std::decay_t<A>>,
+        has_value_or_cref_params<F>,
+        std::is_invocable<F, Args..., curry_arg_type_t<F, sizeof...(Args), A>>,
+        std::is_invocable<const F&, const Args&..., A>>;
+
+    template < typename F, std::size_t... Is, typename... Args, typename A >
+    KARI_HPP_INLINE constexpr auto apply_curry_args(
+        const F& f,
+        const curry_args_impl<std::index_sequence<Is...>, Args...>& args,
+        A&& a)
+    noexcept(std::is_nothrow_invocable_v<const F&, const Args&..., A>)
+    {
+        return f(get_curry_arg<Is>(args)..., KARI_HPP_FWD(a));
+    }
 }
 
 namespace kari_hpp
@@ -52,57 +385,124 @@ namespace kari_hpp
     template < typename F, typename... Args >
     class curry_t final {
     public:
-        constexpr curry_t(F f)
-        : f_(std::move(f)) {}
+        KARI_HPP_INLINE constexpr curry_t(F f)
+        noexcept(std::is_nothrow_move_constructible_v<F>)
+        : f_(KARI_HPP_MOVE(f)) {}
 
         constexpr curry_t(F f, std::tuple<Args...> args)
-        : f_(std::move(f))
-        , args_(std::move(args)) {}
+        noexcept(detail::is_nothrow_move_constructible_all_v<F, Args...>)
+        : f_(KARI_HPP_MOVE(f))
+        , args_(detail::make_curry_args(std::index_sequence_for<Args...>(), KARI_HPP_MOVE(args))) {}
 
-        constexpr auto operator()() && {
+        KARI_HPP_INLINE constexpr curry_t(F f, detail::curry_args_t<Args...> args)
+        noexcept(detail::is_nothrow_move_constructible_all_v<F, Args...>)
+        : f_(KARI_HPP_MOVE(f))
+        , args_(KARI_HPP_MOVE(args)) {}
+
+        KARI_HPP_INLINE constexpr auto operator()() &&
+        noexcept(detail::is_nothrow_curry_or_apply_v<F, Args...>)
+        {
             return detail::curry_or_apply(
-                std::move(f_),
-                std::move(args_));
+                KARI_HPP_MOVE(f_),
+                KARI_HPP_MOVE(args_));
         }
 
         template < typename A >
-        constexpr auto operator()(A&& a) && {
+        KARI_HPP_INLINE constexpr auto operator()(A&& a) &&
+        noexcept(
+            detail::is_nothrow_move_constructible_all_v<Args...> &&
+            std::is_nothrow_constructible_v<detail::curry_arg_type_t<F, sizeof...(Args), A>, A> &&
+            detail::is_nothrow_curry_or_apply_v<F, Args..., detail::curry_arg_type_t<F, sizeof...(Args), A>>)
+        {
             return detail::curry_or_apply(
-                std::move(f_),
-                std::tuple_cat(
-                    std::move(args_),
-                    std::make_tuple(std::forward<A>(a))));
+                KARI_HPP_MOVE(f_),
+                detail::append_curry_arg<detail::curry_arg_type_t<F, sizeof...(Args), A>>(
+                    KARI_HPP_MOVE(args_),
+                    KARI_HPP_FWD(a)));
         }
 
         template < typename A, typename... As >
-        constexpr auto operator()(A&& a, As&&... as) && {
-            return std::move(*this)(std::forward<A>(a))(std::forward<As>(as)...);
+        KARI_HPP_INLINE constexpr auto operator()(A&& a, As&&... as) &&
+        noexcept(noexcept(std::declval<curry_t&&>()(std::declval<A>())(std::declval<As>()...)))
+        {
+            return KARI_HPP_MOVE(*this)(KARI_HPP_FWD(a))(KARI_HPP_FWD(as)...);
+        }
+
+        template < typename A
+                 , std::enable_if_t<detail::is_curry_args_appliable_v<F, A, Args...>, int> = 0 >
+        KARI_HPP_INLINE constexpr auto operator()(A&& a) const &
+        noexcept(std::is_nothrow_invocable_v<const F&, const Args&..., A>)
+        {
+            return detail::apply_curry_args(f_, args_, KARI_HPP_FWD(a));
+        }
+
+        template < typename A
+                 , std::enable_if_t<!detail::is_curry_args_appliable_v<F, A, Args...>, int> = 0 >
+        KARI_HPP_INLINE constexpr auto operator()(A&& a) const &
+        noexcept(
+            detail::is_nothrow_copy_constructible_all_v<F, Args...> &&
+            noexcept(std::declval<curry_t&&>()(std::declval<A>())))
+        {
+            return curry_t(*this)(KARI_HPP_FWD(a));
         }
 
         template < typename... As >
-        constexpr auto operator()(As&&... as) const & {
-            return std::move(curry_t(*this))(std::forward<As>(as)...);
+        KARI_HPP_INLINE constexpr auto operator()(As&&... as) const &
+        noexcept(
+            detail::is_nothrow_copy_constructible_all_v<F, Args...> &&
+            noexcept(std::declval<curry_t&&>()(std::declval<As>()...)))
+        {
+            return curry_t(*this)(KARI_HPP_FWD(as)...);
         }
     private:
+        friend struct detail::curry_access;
         F f_;
-        std::tuple<Args...> args_;
+        detail::curry_args_t<Args...> args_;
+    };
+}
+
+namespace kari_hpp::detail
+{
+    //
+    // curry_access
+    //
+    // Read access to the function and bound arguments of a curried
+    // function, for splitting compositions into their parts.
+    //
+
+    struct curry_access {
+        template < typename F, typename... Args >
+        static constexpr const F& function(const curry_t<F, Args...>& c) noexcept {
+            return c.f_;
+        }
+
+        template < std::size_t I, typename F, typename... Args >
+        static constexpr const auto& arg(const curry_t<F, Args...>& c) noexcept {
+            return get_curry_arg<I>(c.args_);
+        }
     };
 }
 
 namespace kari_hpp
 {
     template < typename F >
-    constexpr auto curry(F&& f) {
+    KARI_HPP_INLINE constexpr auto curry(F&& f)
+    noexcept(is_curried_v<std::decay_t<F>>
+        ? std::is_nothrow_constructible_v<std::decay_t<F>, F>
+        : detail::is_nothrow_curry_or_apply_v<std::decay_t<F>>)
+    {
         if constexpr ( is_curried_v<std::decay_t<F>> ) {
-            return std::forward<F>(f);
+            return KARI_HPP_FWD(f);
         } else {
-            return detail::curry_or_apply(std::forward<F>(f), {});
+            return detail::curry_or_apply(KARI_HPP_FWD(f), detail::curry_args_t<>{});
         }
     }
 
     template < typename F, typename A, typename... As >
-    constexpr auto curry(F&& f, A&& a, As&&... as) {
-        return curry(std::forward<F>(f))(std::forward<A>(a), std::forward<As>(as)...);
+    KARI_HPP_INLINE constexpr auto curry(F&& f, A&& a, As&&... as)
+    noexcept(noexcept(curry(std::declval<F>())(std::declval<A>(), std::declval<As>()...)))
+    {
+        return curry(KARI_HPP_FWD(f))(KARI_HPP_FWD(a), KARI_HPP_FWD(as)...);
     }
 }
 
@@ -114,8 +514,10 @@ namespace kari_hpp::ext
 
     struct fid_t {
         template < typename A >
-        constexpr auto operator()(A&& a) const {
-            return std::forward<A>(a);
+        KARI_HPP_INLINE constexpr auto operator()(A&& a) const
+        noexcept(std::is_nothrow_constructible_v<std::decay_t<A>, A>)
+        {
+            return KARI_HPP_FWD(a);
         }
     };
     inline constexpr auto fid = curry(fid_t{});
@@ -126,8 +528,10 @@ namespace kari_hpp::ext
 
     struct fconst_t {
         template < typename A, typename B >
-        constexpr auto operator()(A&& a, [[maybe_unused]] B&& b) const {
-            return std::forward<A>(a);
+        KARI_HPP_INLINE constexpr auto operator()(A&& a, [[maybe_unused]] B&& b) const
+        noexcept(std::is_nothrow_constructible_v<std::decay_t<A>, A>)
+        {
+            return KARI_HPP_FWD(a);
         }
     };
     inline constexpr auto fconst = curry(fconst_t{});
@@ -138,8 +542,10 @@ namespace kari_hpp::ext
 
     struct fflip_t {
         template < typename F, typename A, typename B >
-        constexpr auto operator()(F&& f, A&& a, B&& b) const {
-            return curry(std::forward<F>(f), std::forward<B>(b), std::forward<A>(a));
+        KARI_HPP_INLINE constexpr auto operator()(F&& f, A&& a, B&& b) const
+        noexcept(noexcept(curry(std::declval<F>(), std::declval<B>(), std::declval<A>())))
+        {
+            return curry(KARI_HPP_FWD(f), KARI_HPP_FWD(b), KARI_HPP_FWD(a));
         }
     };
     inline constexpr auto fflip = curry(fflip_t{});
@@ -150,10 +556,14 @@ namespace kari_hpp::ext
 
     struct fpipe_t {
         template < typename G, typename F, typename A >
-        constexpr auto operator()(G&& g, F&& f, A&& a) const {
+        KARI_HPP_INLINE constexpr auto operator()(G&& g, F&& f, A&& a) const
+        noexcept(noexcept(curry(
+            std::declval<F>(),
+            curry(std::declval<G>(), std::declval<A>()))))
+        {
             return curry(
-                std::forward<F>(f),
-                curry(std::forward<G>(g), std::forward<A>(a)));
+                KARI_HPP_FWD(f),
+                curry(KARI_HPP_FWD(g), KARI_HPP_FWD(a)));
         }
     };
     inline constexpr auto fpipe = curry(fpipe_t{});
@@ -164,14 +574,68 @@ namespace kari_hpp::ext
 
     struct fcompose_t {
         template < typename G, typename F, typename A >
-        constexpr auto operator()(G&& g, F&& f, A&& a) const {
+        KARI_HPP_INLINE constexpr auto operator()(G&& g, F&& f, A&& a) const
+        noexcept(noexcept(curry(
+            std::declval<G>(),
+            curry(std::declval<F>(), std::declval<A>()))))
+        {
             return curry(
-                std::forward<G>(g),
-                curry(std::forward<F>(f), std::forward<A>(a)));
+                KARI_HPP_FWD(g),
+                curry(KARI_HPP_FWD(f), KARI_HPP_FWD(a)));
         }
     };
     inline constexpr auto fcompose = curry(fcompose_t{});
 
+    //
+    // fstage
+    //
+    // Staged partial application: `fstage(prepare, run)` passes leading
+    // arguments to `prepare` and binds its result to `run` instead of them.
+    // The preparation runs once, as soon as `prepare` can be called, and
+    // every call of the partial closure reuses the prepared value:
+    //
+    //   auto match = fstage(compile_regex, match_regex);
+    //   auto m = match("a+b"); // compile_regex("a+b")
+    //   m("aab");              // match_regex(regex, "aab")
+    //
+    // Stages chain, the next `prepare` gets the prepared value first:
+    //
+    //   fstage(prepare1, fstage(prepare2, run))
+    //
+
+    struct fstage_t {
+        template < typename P, typename R, typename... As
+                 , typename V = decltype(std::declval<P>()(std::declval<As>()...))
+                 , std::enable_if_t<!is_curried_v<std::decay_t<V>>, int> = 0 >
+        KARI_HPP_INLINE constexpr auto operator()(P&& p, R&& r, As&&... as) const
+        noexcept(
+            noexcept(std::declval<P>()(std::declval<As>()...)) &&
+            noexcept(curry(std::declval<R>(), std::declval<V>())))
+        {
+            return curry(KARI_HPP_FWD(r), KARI_HPP_FWD(p)(KARI_HPP_FWD(as)...));
+        }
+    };
+    inline constexpr auto fstage = curry(fstage_t{});
+}
+
+namespace kari_hpp::detail
+{
+    // noexcept of the composition operators, C composes two curried
+    // functions, otherwise the curried one is applied to the other
+    template < typename C, typename G, typename F >
+    constexpr bool is_nothrow_composition_operator() noexcept {
+        if constexpr ( is_curried_v<std::decay_t<G>> && is_curried_v<std::decay_t<F>> ) {
+            return noexcept(std::declval<const C&>()(std::declval<G>(), std::declval<F>()));
+        } else if constexpr ( is_curried_v<std::decay_t<G>> ) {
+            return noexcept(std::declval<G>()(std::declval<F>()));
+        } else {
+            return noexcept(std::declval<F>()(std::declval<G>()));
+        }
+    }
+}
+
+namespace kari_hpp::ext
+{
     //
     // fpipe operators
     //
@@ -180,20 +644,22 @@ namespace kari_hpp::ext
              , std::enable_if_t<std::disjunction_v<
                 is_curried<std::decay_t<G>>,
                 is_curried<std::decay_t<F>>>, int> = 0 >
-    constexpr auto operator|(G&& g, F&& f) {
+    KARI_HPP_INLINE constexpr auto operator|(G&& g, F&& f)
+    noexcept(detail::is_nothrow_composition_operator<decltype(fpipe), G, F>())
+    {
         constexpr bool gc = is_curried_v<std::decay_t<G>>;
         constexpr bool fc = is_curried_v<std::decay_t<F>>;
 
         if constexpr ( gc && fc ) {
-            return fpipe(std::forward<G>(g), std::forward<F>(f));
+            return fpipe(KARI_HPP_FWD(g), KARI_HPP_FWD(f));
         }
 
         if constexpr ( gc && !fc) {
-            return std::forward<G>(g)(std::forward<F>(f));
+            return KARI_HPP_FWD(g)(KARI_HPP_FWD(f));
         }
 
         if constexpr ( !gc && fc) {
-            return std::forward<F>(f)(std::forward<G>(g));
+            return KARI_HPP_FWD(f)(KARI_HPP_FWD(g));
         }
 
         static_assert(gc || fc, "F or G or both arguments should be curried");
@@ -207,26 +673,795 @@ namespace kari_hpp::ext
              , std::enable_if_t<std::disjunction_v<
                 is_curried<std::decay_t<G>>,
                 is_curried<std::decay_t<F>>>, int> = 0 >
-    constexpr auto operator*(G&& g, F&& f) {
+    KARI_HPP_INLINE constexpr auto operator*(G&& g, F&& f)
+    noexcept(detail::is_nothrow_composition_operator<decltype(fcompose), G, F>())
+    {
         constexpr bool gc = is_curried_v<std::decay_t<G>>;
         constexpr bool fc = is_curried_v<std::decay_t<F>>;
 
         if constexpr ( gc && fc ) {
-            return fcompose(std::forward<G>(g), std::forward<F>(f));
+            return fcompose(KARI_HPP_FWD(g), KARI_HPP_FWD(f));
         }
 
         if constexpr ( gc && !fc) {
-            return std::forward<G>(g)(std::forward<F>(f));
+            return KARI_HPP_FWD(g)(KARI_HPP_FWD(f));
         }
 
         if constexpr ( !gc && fc) {
-            return std::forward<F>(f)(std::forward<G>(g));
+            return KARI_HPP_FWD(f)(KARI_HPP_FWD(g));
         }
 
         static_assert(gc || fc, "F or G or both arguments should be curried");
     }
 }
 
+namespace kari_hpp::detail
+{
+    //
+    // composition_stages
+    //
+    // Splits fpipe and fcompose compositions into a tuple of their stages
+    // in the order of application.
+    //
+
+    template < typename F >
+    struct composition_stages {
+        static std::tuple<F> split(const F& f) {
+            return std::tuple<F>(f);
+        }
+    };
+
+    template < typename G, typename F >
+    struct composition_stages<curry_t<ext::fpipe_t, G, F>> {
+        static auto split(const curry_t<ext::fpipe_t, G, F>& c) {
+            return std::tuple_cat(
+                composition_stages<G>::split(curry_access::arg<0>(c)),
+                composition_stages<F>::split(curry_access::arg<1>(c)));
+        }
+    };
+
+    template < typename G, typename F >
+    struct composition_stages<curry_t<ext::fcompose_t, G, F>> {
+        static auto split(const curry_t<ext::fcompose_t, G, F>& c) {
+            return std::tuple_cat(
+                composition_stages<F>::split(curry_access::arg<1>(c)),
+                composition_stages<G>::split(curry_access::arg<0>(c)));
+        }
+    };
+}
+
+namespace kari_hpp::ext
+{
+    //
+    // bind_traits
+    //
+    // Describes types with an empty or error state (std::optional and
+    // std::expected-like types) for fbind. Specialize it for other types.
+    //
+
+    template < typename M, typename = void >
+    struct bind_traits {};
+
+    template < typename T >
+    struct bind_traits<std::optional<T>> {
+        template < typename U >
+        using rebind = std::optional<U>;
+
+        template < typename R, typename M >
+        static constexpr R failure([[maybe_unused]] M&& m)
+        noexcept(std::is_nothrow_constructible_v<R, std::nullopt_t>)
+        {
+            return R(std::nullopt);
+        }
+    };
+
+    template < typename M >
+    struct bind_traits<M, std::void_t<
+        typename M::value_type,
+        typename M::error_type,
+        typename M::unexpected_type>>
+    {
+        template < typename U >
+        using rebind = typename M::template rebind<U>;
+
+        template < typename R, typename N >
+        static constexpr R failure(N&& m)
+        noexcept(noexcept(R(typename M::unexpected_type(std::declval<N>().error()))))
+        {
+            return R(typename M::unexpected_type(KARI_HPP_FWD(m).error()));
+        }
+    };
+
+    //
+    // is_bindable, is_bindable_v
+    //
+
+    template < typename M, typename = void >
+    struct is_bindable
+    : std::false_type {};
+
+    template < typename M >
+    struct is_bindable<M, std::void_t<
+        typename bind_traits<std::remove_cv_t<M>>::template rebind<M>>>
+    : std::true_type {};
+
+    template < typename M >
+    inline constexpr bool is_bindable_v = is_bindable<M>::value;
+}
+
+namespace kari_hpp::detail
+{
+    template < typename F, typename M >
+    struct bind_result {
+        using traits = ext::bind_traits<std::decay_t<M>>;
+        using invoke_type = decltype(curry(std::declval<F>(), *std::declval<M>()));
+        using type = std::conditional_t<
+            ext::is_bindable_v<invoke_type>,
+            invoke_type,
+            typename traits::template rebind<invoke_type>>;
+    };
+
+    template < typename F, typename M >
+    inline constexpr bool is_nothrow_bind_v =
+        noexcept(static_cast<bool>(std::declval<M&>().has_value())) &&
+        noexcept(curry(std::declval<F>(), *std::declval<M>())) &&
+        std::is_nothrow_constructible_v<
+            typename bind_result<F, M>::type,
+            typename bind_result<F, M>::invoke_type> &&
+        noexcept(bind_result<F, M>::traits::template failure<
+            typename bind_result<F, M>::type>(std::declval<M>()));
+}
+
+namespace kari_hpp::ext
+{
+    //
+    // fbind
+    //
+    // Applies `f` to the value of `m` or returns the empty/error state of
+    // `m` without calling `f`. Plain results of `f` are wrapped back into
+    // the type of `m`, so ordinary curried stages work unchanged.
+    //
+
+    struct fbind_t {
+        template < typename F, typename M >
+        KARI_HPP_INLINE constexpr auto operator()(F&& f, M&& m) const
+        noexcept(detail::is_nothrow_bind_v<F, M>)
+        {
+            using traits = typename detail::bind_result<F, M>::traits;
+            using result_t = typename detail::bind_result<F, M>::type;
+
+            if ( !m.has_value() ) {
+                return traits::template failure<result_t>(KARI_HPP_FWD(m));
+            }
+
+            return result_t(curry(KARI_HPP_FWD(f), *KARI_HPP_FWD(m)));
+        }
+    };
+    inline constexpr auto fbind = curry(fbind_t{});
+}
+
+namespace kari_hpp::detail
+{
+    template < typename G, typename F, typename A
+             , bool = ext::is_bindable_v<decltype(curry(std::declval<G>(), std::declval<A>()))> >
+    struct is_nothrow_kleisli
+    : std::bool_constant<noexcept(curry(
+        std::declval<F>(),
+        curry(std::declval<G>(), std::declval<A>())))> {};
+
+    template < typename G, typename F, typename A >
+    struct is_nothrow_kleisli<G, F, A, true>
+    : std::bool_constant<noexcept(ext::fbind_t{}(
+        std::declval<F>(),
+        curry(std::declval<G>(), std::declval<A>())))> {};
+}
+
+namespace kari_hpp::ext
+{
+    //
+    // fkleisli
+    //
+    // Left-to-right composition of stages that may fail. A failing stage
+    // returns straight to the caller, the remaining stages are not even
+    // checked.
+    //
+
+    struct fkleisli_t {
+        template < typename G, typename F, typename A >
+        KARI_HPP_INLINE constexpr auto operator()(G&& g, F&& f, A&& a) const
+        noexcept(detail::is_nothrow_kleisli<G, F, A>::value)
+        {
+            if constexpr ( is_bindable_v<decltype(curry(std::declval<G>(), std::declval<A>()))> ) {
+                return fbind_t{}(
+                    KARI_HPP_FWD(f),
+                    curry(KARI_HPP_FWD(g), KARI_HPP_FWD(a)));
+            } else {
+                return curry(
+                    KARI_HPP_FWD(f),
+                    curry(KARI_HPP_FWD(g), KARI_HPP_FWD(a)));
+            }
+        }
+    };
+    inline constexpr auto fkleisli = curry(fkleisli_t{});
+}
+
+namespace kari_hpp::detail
+{
+    // noexcept of `g |= f`, kleisli composition of two curried functions
+    // or binding of a monadic value
+    template < typename G, typename F >
+    constexpr bool is_nothrow_bind_operator() noexcept {
+        if constexpr ( is_curried_v<std::decay_t<G>> ) {
+            return noexcept(ext::fkleisli(std::declval<G>(), std::declval<F>()));
+        } else {
+            return noexcept(ext::fbind(std::declval<F>(), std::declval<G>()));
+        }
+    }
+}
+
+namespace kari_hpp::ext
+{
+    //
+    // fbind operators
+    //
+    // `m |= f |= g` is right-associative: `m |= (f |= g)`
+    //
+
+    template < typename G, typename F
+             , std::enable_if_t<std::conjunction_v<
+                std::disjunction<
+                    is_bindable<std::decay_t<G>>,
+                    is_curried<std::decay_t<G>>>,
+                is_curried<std::decay_t<F>>>, int> = 0 >
+    [[nodiscard]] KARI_HPP_INLINE constexpr auto operator|=(G&& g, F&& f)
+    noexcept(detail::is_nothrow_bind_operator<G, F>())
+    {
+        if constexpr ( is_curried_v<std::decay_t<G>> ) {
+            return fkleisli(KARI_HPP_FWD(g), KARI_HPP_FWD(f));
+        } else {
+            return fbind(KARI_HPP_FWD(f), KARI_HPP_FWD(g));
+        }
+    }
+}
+
+namespace kari_hpp::detail
+{
+    template < typename T, typename = void >
+    struct is_tuple_like
+    : std::false_type {};
+
+    template < typename T >
+    struct is_tuple_like<T, std::void_t<decltype(std::tuple_size<T>::value)>>
+    : std::true_type {};
+
+    template < typename F, typename T, std::size_t... Is >
+    KARI_HPP_INLINE constexpr auto spread_tuple(F&& f, T&& t, std::index_sequence<Is...>)
+    noexcept(noexcept(curry(std::declval<F>(), std::get<Is>(std::declval<T>())...)))
+    {
+        return curry(KARI_HPP_FWD(f), std::get<Is>(KARI_HPP_FWD(t))...);
+    }
+
+    // empty for other types, so fspread reports them with its static_assert
+    template < typename T, bool = is_tuple_like<std::decay_t<T>>::value >
+    struct tuple_indices {
+        using type = std::make_index_sequence<std::tuple_size_v<std::decay_t<T>>>;
+    };
+
+    template < typename T >
+    struct tuple_indices<T, false> {
+        using type = std::index_sequence<>;
+    };
+
+    template < typename T >
+    using tuple_index_sequence = typename tuple_indices<T>::type;
+}
+
+namespace kari_hpp::ext
+{
+    //
+    // fspread
+    //
+    // Passes the elements of a tuple-like value (std::tuple, std::pair,
+    // std::array) to `f` as separate arguments. The elements of rvalues are
+    // moved, and `f` may take more arguments than there are elements:
+    //
+    //   fspread(_+_, std::pair(1, 2)); // 3
+    //   auto p = split_name | fspread(make_person);
+    //   p("Ada Lovelace", 36);         // make_person("Ada", "Lovelace", 36)
+    //
+    // `g | fspread(f)` is the pipe mode: every result of `g` is spread
+    // into `f` without an unpacking lambda.
+    //
+
+    struct fspread_t {
+        template < typename F, typename T >
+        KARI_HPP_INLINE constexpr auto operator()(F&& f, T&& t) const
+        noexcept(noexcept(detail::spread_tuple(
+            std::declval<F>(),
+            std::declval<T>(),
+            detail::tuple_index_sequence<T>())))
+        {
+            static_assert(
+                detail::is_tuple_like<std::decay_t<T>>::value,
+                "fspread argument should be a tuple-like value");
+            return detail::spread_tuple(
+                KARI_HPP_FWD(f),
+                KARI_HPP_FWD(t),
+                detail::tuple_index_sequence<T>());
+        }
+    };
+    inline constexpr auto fspread = curry(fspread_t{});
+}
+
+namespace kari_hpp::ext
+{
+    //
+    // is_associative, is_associative_v
+    //
+    // Reduction functions may regroup arguments of associative functions
+    // and reorder arguments of commutative ones. Specialize these traits
+    // or wrap a function with fassociative/fcommutative to opt in.
+    //
+
+    template < typename F >
+    struct is_associative
+    : std::false_type {};
+
+    template < typename F >
+    inline constexpr bool is_associative_v = is_associative<std::remove_cv_t<F>>::value;
+
+    //
+    // is_commutative, is_commutative_v
+    //
+
+    template < typename F >
+    struct is_commutative
+    : std::false_type {};
+
+    template < typename F >
+    inline constexpr bool is_commutative_v = is_commutative<std::remove_cv_t<F>>::value;
+
+    #define KARI_HPP_DEFINE_ASSOCIATIVE_AND_COMMUTATIVE(func)\
+        template < typename T >\
+        struct is_associative<func<T>>\
+        : std::true_type {};\
+        \
+        template < typename T >\
+        struct is_commutative<func<T>>\
+        : std::true_type {};
+
+        KARI_HPP_DEFINE_ASSOCIATIVE_AND_COMMUTATIVE(std::plus)
+        KARI_HPP_DEFINE_ASSOCIATIVE_AND_COMMUTATIVE(std::multiplies)
+        KARI_HPP_DEFINE_ASSOCIATIVE_AND_COMMUTATIVE(std::bit_or)
+        KARI_HPP_DEFINE_ASSOCIATIVE_AND_COMMUTATIVE(std::bit_and)
+        KARI_HPP_DEFINE_ASSOCIATIVE_AND_COMMUTATIVE(std::bit_xor)
+        KARI_HPP_DEFINE_ASSOCIATIVE_AND_COMMUTATIVE(std::logical_or)
+        KARI_HPP_DEFINE_ASSOCIATIVE_AND_COMMUTATIVE(std::logical_and)
+    #undef KARI_HPP_DEFINE_ASSOCIATIVE_AND_COMMUTATIVE
+
+    template < typename F >
+    struct is_associative<curry_t<F>>
+    : is_associative<F> {};
+
+    template < typename F >
+    struct is_commutative<curry_t<F>>
+    : is_commutative<F> {};
+
+    //
+    // fassociative
+    //
+
+    template < typename F >
+    struct associative_t {
+        F f;
+
+        template < typename A, typename B >
+        KARI_HPP_INLINE constexpr auto operator()(A&& a, B&& b) const
+        noexcept(noexcept(std::declval<const F&>()(std::declval<A>(), std::declval<B>())))
+        -> decltype(std::declval<const F&>()(std::declval<A>(), std::declval<B>()))
+        {
+            return f(KARI_HPP_FWD(a), KARI_HPP_FWD(b));
+        }
+    };
+
+    template < typename F >
+    struct is_associative<associative_t<F>>
+    : std::true_type {};
+
+    template < typename F >
+    struct is_commutative<associative_t<F>>
+    : is_commutative<F> {};
+
+    struct fassociative_t {
+        template < typename F >
+        KARI_HPP_INLINE constexpr auto operator()(F&& f) const
+        noexcept(std::is_nothrow_constructible_v<std::decay_t<F>, F>)
+        {
+            return curry(associative_t<std::decay_t<F>>{KARI_HPP_FWD(f)});
+        }
+    };
+    inline constexpr auto fassociative = curry(fassociative_t{});
+
+    //
+    // fcommutative
+    //
+
+    template < typename F >
+    struct commutative_t {
+        F f;
+
+        template < typename A, typename B >
+        KARI_HPP_INLINE constexpr auto operator()(A&& a, B&& b) const
+        noexcept(noexcept(std::declval<const F&>()(std::declval<A>(), std::declval<B>())))
+        -> decltype(std::declval<const F&>()(std::declval<A>(), std::declval<B>()))
+        {
+            return f(KARI_HPP_FWD(a), KARI_HPP_FWD(b));
+        }
+    };
+
+    template < typename F >
+    struct is_associative<commutative_t<F>>
+    : is_associative<F> {};
+
+    template < typename F >
+    struct is_commutative<commutative_t<F>>
+    : std::true_type {};
+
+    struct fcommutative_t {
+        template < typename F >
+        KARI_HPP_INLINE constexpr auto operator()(F&& f) const
+        noexcept(std::is_nothrow_constructible_v<std::decay_t<F>, F>)
+        {
+            return curry(commutative_t<std::decay_t<F>>{KARI_HPP_FWD(f)});
+        }
+    };
+    inline constexpr auto fcommutative = curry(fcommutative_t{});
+}
+
+namespace kari_hpp::detail
+{
+    inline constexpr std::size_t reduce_lanes = 8;
+    inline constexpr std::size_t reduce_leaf_size = 64;
+
+    template < typename T, typename F, typename Iter >
+    constexpr T fold_range(const F& f, T init, Iter first, Iter last) {
+        for ( ; first != last; ++first ) {
+            init = f(std::move(init), *first);
+        }
+        return init;
+    }
+
+    // Independent accumulators over interleaved elements have no
+    // loop-carried dependency, so the main loop is vectorizable.
+    // Requires associative and commutative `f` and at least
+    // `reduce_lanes` elements.
+
+    template < typename T, typename F, typename Iter, std::size_t... Is >
+    constexpr T lanes_reduce_range(const F& f, Iter first, Iter last, std::index_sequence<Is...>) {
+        constexpr std::size_t lanes = sizeof...(Is);
+        T acc[lanes] = {T(first[static_cast<std::ptrdiff_t>(Is)])...};
+
+        const auto size = static_cast<std::size_t>(last - first);
+        const std::size_t body = size - size % lanes;
+
+        for ( std::size_t i = lanes; i < body; i += lanes ) {
+            ((acc[Is] = f(std::move(acc[Is]), first[static_cast<std::ptrdiff_t>(i + Is)])), ...);
+        }
+
+        for ( std::size_t width = lanes / 2; width > 0; width /= 2 ) {
+            for ( std::size_t i = 0; i < width; ++i ) {
+                acc[i] = f(std::move(acc[i]), std::move(acc[i + width]));
+            }
+        }
+
+        return fold_range(f, std::move(acc[0]), first + static_cast<std::ptrdiff_t>(body), last);
+    }
+
+    // Pairwise reduction of non-empty ranges, keeps the order of elements.
+    // Requires associative `f`.
+
+    template < typename T, typename F, typename Iter >
+    constexpr T tree_reduce_range(const F& f, Iter first, Iter last) {
+        const auto size = static_cast<std::size_t>(last - first);
+
+        // std::plus<> and friends are commutative for numbers but not
+        // for strings, so only trivially copyable values are reordered
+        if constexpr ( ext::is_commutative_v<F> && std::is_trivially_copyable_v<T> ) {
+            if ( size >= reduce_lanes * 2 ) {
+                return lanes_reduce_range<T>(
+                    f, first, last, std::make_index_sequence<reduce_lanes>());
+            }
+        }
+
+        if ( size <= reduce_leaf_size ) {
+            return fold_range(f, T(*first), std::next(first), last);
+        }
+
+        const Iter middle = first + static_cast<std::ptrdiff_t>(size / 2);
+        return f(
+            tree_reduce_range<T>(f, first, middle),
+            tree_reduce_range<T>(f, middle, last));
+    }
+
+    template < typename Iter >
+    inline constexpr bool is_random_access_iterator_v = std::is_base_of_v<
+        std::random_access_iterator_tag,
+        typename std::iterator_traits<Iter>::iterator_category>;
+}
+
+namespace kari_hpp::detail::range_adl
+{
+    using std::begin;
+    using std::end;
+
+    template < typename R >
+    using iterator_t = decltype(begin(std::declval<R&>()));
+}
+
+namespace kari_hpp::detail
+{
+    // begin(), end() and the other iterator operations are assumed not
+    // to throw when copying, increment, dereference and comparison don't
+    // (std::begin and std::end are not noexcept even for std containers)
+
+    template < typename Iter >
+    inline constexpr bool is_nothrow_iterator_v =
+        std::is_nothrow_copy_constructible_v<Iter> &&
+        noexcept(++std::declval<Iter&>()) &&
+        noexcept(*std::declval<Iter&>()) &&
+        noexcept(std::declval<Iter&>() != std::declval<Iter&>());
+
+    template < typename F, typename T, typename R
+             , typename V = std::decay_t<T>
+             , typename Iter = range_adl::iterator_t<R> >
+    inline constexpr bool is_nothrow_fold_v =
+        std::is_nothrow_constructible_v<V, T> &&
+        std::is_nothrow_move_constructible_v<V> &&
+        std::is_nothrow_move_assignable_v<V> &&
+        is_nothrow_iterator_v<Iter> &&
+        std::is_nothrow_invocable_r_v<V, const std::decay_t<F>&, V, decltype(*std::declval<Iter&>())>;
+
+    template < typename F, typename T, typename R
+             , typename V = std::decay_t<T>
+             , typename Iter = range_adl::iterator_t<R> >
+    inline constexpr bool is_nothrow_reduce_v =
+        is_nothrow_fold_v<F, T, R> &&
+        std::is_nothrow_constructible_v<V, decltype(*std::declval<Iter&>())> &&
+        std::is_nothrow_invocable_r_v<V, const std::decay_t<F>&, V, V>;
+}
+
+namespace kari_hpp::ext
+{
+    //
+    // ffold
+    //
+    // Strict left fold: f(...f(f(init, r0), r1)..., rN)
+    //
+
+    struct ffold_t {
+        template < typename F, typename T, typename R >
+        KARI_HPP_INLINE constexpr auto operator()(F&& f, T&& init, R&& range) const
+        noexcept(detail::is_nothrow_fold_v<F, T, R>)
+        {
+            using std::begin;
+            using std::end;
+            return detail::fold_range(
+                f,
+                std::decay_t<T>(KARI_HPP_FWD(init)),
+                begin(range), end(range));
+        }
+    };
+    inline constexpr auto ffold = curry(ffold_t{});
+
+    //
+    // freduce
+    //
+    // Like ffold, but regroups (associative `f`) and reorders (associative
+    // and commutative `f`) the calls to reduce random access ranges as a
+    // balanced tree. Falls back to ffold otherwise.
+    //
+    // Both take lvalue ranges by reference, rvalue ranges are moved.
+    //
+
+    struct freduce_t {
+        template < typename F, typename T, typename R >
+        KARI_HPP_INLINE constexpr auto operator()(F&& f, T&& init, R&& range) const
+        noexcept(detail::is_nothrow_reduce_v<F, T, R>)
+        {
+            using std::begin;
+            using std::end;
+            using iter_t = decltype(begin(range));
+            using value_t = std::decay_t<T>;
+
+            if constexpr ( is_associative_v<std::decay_t<F>>
+                && detail::is_random_access_iterator_v<iter_t> )
+            {
+                const iter_t first = begin(range);
+                const iter_t last = end(range);
+                if ( first == last ) {
+                    return value_t(KARI_HPP_FWD(init));
+                }
+                return value_t(f(
+                    value_t(KARI_HPP_FWD(init)),
+                    detail::tree_reduce_range<value_t>(f, first, last)));
+            } else {
+                return ffold_t{}(KARI_HPP_FWD(f), KARI_HPP_FWD(init), KARI_HPP_FWD(range));
+            }
+        }
+    };
+    inline constexpr auto freduce = curry(freduce_t{});
+}
+
+namespace kari_hpp::detail
+{
+    template <>
+    struct is_bound_by_reference<ext::ffold_t, 2>
+    : std::true_type {};
+
+    template <>
+    struct is_bound_by_reference<ext::freduce_t, 2>
+    : std::true_type {};
+}
+
+namespace kari_hpp::ext
+{
+    //
+    // domain
+    //
+    // A closed range of integral or enumeration values [Min, Max].
+    //
+
+    template < typename T, T Min, T Max >
+    struct domain {
+        using value_type = T;
+        static constexpr T min = Min;
+        static constexpr T max = Max;
+    };
+
+    //
+    // domain_of
+    //
+    // 8-bit integral types are domains of all of their values. Larger
+    // domains should be explicit, their tables may exceed the limits of
+    // compile-time evaluation.
+    //
+
+    template < typename D, typename = void >
+    struct domain_of {};
+
+    template < typename T, T Min, T Max >
+    struct domain_of<domain<T, Min, Max>> {
+        using type = domain<T, Min, Max>;
+    };
+
+    template < typename T >
+    struct domain_of<T, std::enable_if_t<std::is_integral_v<T> && sizeof(T) == 1>> {
+        using type = domain<T, std::numeric_limits<T>::min(), std::numeric_limits<T>::max()>;
+    };
+
+    template < typename D >
+    using domain_of_t = typename domain_of<D>::type;
+}
+
+namespace kari_hpp::detail
+{
+    template < typename T >
+    constexpr long long domain_value_to_integer(T v) noexcept {
+        if constexpr ( std::is_enum_v<T> ) {
+            return static_cast<long long>(static_cast<std::underlying_type_t<T>>(v));
+        } else {
+            return static_cast<long long>(v);
+        }
+    }
+
+    template < typename T >
+    constexpr T domain_value_from_integer(long long v) noexcept {
+        if constexpr ( std::is_enum_v<T> ) {
+            return static_cast<T>(static_cast<std::underlying_type_t<T>>(v));
+        } else {
+            return static_cast<T>(v);
+        }
+    }
+
+    template < typename D >
+    inline constexpr std::size_t domain_size = static_cast<std::size_t>(
+        domain_value_to_integer(D::max) - domain_value_to_integer(D::min) + 1);
+
+    template < typename D >
+    constexpr std::size_t domain_index(typename D::value_type v) noexcept {
+        return static_cast<std::size_t>(
+            domain_value_to_integer(v) - domain_value_to_integer(D::min));
+    }
+
+    // compares values of any integral type with the bounds without
+    // converting them to the domain type first
+    template < typename D, typename V >
+    constexpr bool domain_contains(V v) noexcept {
+        const long long min = domain_value_to_integer(D::min);
+        const long long max = domain_value_to_integer(D::max);
+        if constexpr ( std::is_enum_v<V> || std::is_signed_v<V> ) {
+            const long long i = domain_value_to_integer(v);
+            return min <= i && i <= max;
+        } else {
+            const auto u = static_cast<unsigned long long>(v);
+            return max >= 0
+                && u <= static_cast<unsigned long long>(max)
+                && (min <= 0 || u >= static_cast<unsigned long long>(min));
+        }
+    }
+
+    template < typename D, typename V >
+    inline constexpr bool is_domain_argument_v = std::is_same_v<V, typename D::value_type> || (
+        std::is_integral_v<V> &&
+        std::is_integral_v<typename D::value_type> &&
+        !std::is_same_v<V, bool>);
+}
+
+namespace kari_hpp::ext
+{
+    //
+    // tabulated_t
+    //
+
+    template < typename D, typename R >
+    class tabulated_t final {
+    public:
+        using domain_type = D;
+        using value_type = typename D::value_type;
+        using result_type = R;
+        using table_type = std::array<R, detail::domain_size<D>>;
+
+        constexpr explicit tabulated_t(const table_type& table)
+        noexcept(std::is_nothrow_copy_constructible_v<table_type>)
+        : table_(table) {}
+
+        // `v` should be in the domain, integral domains take any integral
+        // values and check them before the conversion (in debug builds)
+        template < typename V
+                 , std::enable_if_t<detail::is_domain_argument_v<D, V>, int> = 0 >
+        constexpr R operator()(V v) const
+        noexcept(std::is_nothrow_copy_constructible_v<R>)
+        {
+            assert(detail::domain_contains<D>(v) && "ftabulate argument is out of the domain");
+            return table_[detail::domain_index<D>(static_cast<value_type>(v))];
+        }
+
+        constexpr const table_type& table() const noexcept {
+            return table_;
+        }
+    private:
+        table_type table_;
+    };
+
+    //
+    // ftabulate
+    //
+    // Evaluates a unary function over every value of a domain and returns
+    // a function object backed by the table of results. In a constant
+    // expression the table is computed at compile time:
+    //
+    //   static constexpr auto f = ftabulate<std::uint8_t>((_ * 3) | (_ + 1));
+    //
+    // The table is stored by value, so keep the result in a static and
+    // pass it around by reference (std::cref) rather than by copy.
+    //
+
+    template < typename Domain, typename F >
+    constexpr auto ftabulate(F&& f) {
+        using d_t = domain_of_t<Domain>;
+        using v_t = typename d_t::value_type;
+        using r_t = std::decay_t<decltype(f(std::declval<v_t>()))>;
+
+        typename tabulated_t<d_t, r_t>::table_type table{};
+        for ( std::size_t i = 0; i < table.size(); ++i ) {
+            table[i] = f(detail::domain_value_from_integer<v_t>(
+                detail::domain_value_to_integer(d_t::min) + static_cast<long long>(i)));
+        }
+
+        return tabulated_t<d_t, r_t>(table);
+    }
+}
+
 namespace kari_hpp::ext::underscore
 {
     struct us_t {};
@@ -248,7 +1483,7 @@ namespace kari_hpp::ext::underscore
     //
 
     #define KARI_HPP_DEFINE_UNDERSCORE_UNARY_OP(op, func)\
-        constexpr auto operator op (us_t) {\
+        KARI_HPP_INLINE constexpr auto operator op (us_t) noexcept {\
             return curry(func);\
         }
 
@@ -262,18 +1497,20 @@ namespace kari_hpp::ext::underscore
     //
 
     #define KARI_HPP_DEFINE_UNDERSCORE_BINARY_OP(op, func)\
-        constexpr auto operator op (us_t, us_t) {\
+        KARI_HPP_INLINE constexpr auto operator op (us_t, us_t) noexcept {\
             return curry(func);\
         }\
         \
         template < typename A, std::enable_if_t<!is_underscore_v<std::decay_t<A>>, int> = 0 >\
-        constexpr auto operator op (A&& a, us_t) {\
-            return curry(func, std::forward<A>(a));\
+        KARI_HPP_INLINE constexpr auto operator op (A&& a, us_t)\
+        noexcept(noexcept(curry(func, std::declval<A>()))) {\
+            return curry(func, KARI_HPP_FWD(a));\
         }\
         \
         template < typename B, std::enable_if_t<!is_underscore_v<std::decay_t<B>>, int> = 0 >\
-        constexpr auto operator op (us_t, B&& b) {\
-            return fflip(func, std::forward<B>(b));\
+        KARI_HPP_INLINE constexpr auto operator op (us_t, B&& b)\
+        noexcept(noexcept(fflip(func, std::declval<B>()))) {\
+            return fflip(func, KARI_HPP_FWD(b));\
         }
 
         KARI_HPP_DEFINE_UNDERSCORE_BINARY_OP(+ , std::plus<>())
@@ -297,4 +1534,53 @@ namespace kari_hpp::ext::underscore
         KARI_HPP_DEFINE_UNDERSCORE_BINARY_OP(||, std::logical_or<>())
         KARI_HPP_DEFINE_UNDERSCORE_BINARY_OP(&&, std::logical_and<>())
     #undef KARI_HPP_DEFINE_UNDERSCORE_BINARY_OP
+
+    //
+    // logical operators of curried predicates
+    //
+    // `p && q` and `p || q` build a curried predicate, the right operand
+    // is called only when the left one doesn't decide the result:
+    //
+    //   auto valid = (_ > 0) && curry(expensive_check);
+    //
+
+    struct us_and_t {
+        template < typename P, typename Q, typename... As >
+        KARI_HPP_INLINE constexpr auto operator()(const P& p, const Q& q, As&&... as) const
+        noexcept(noexcept(static_cast<bool>(p(as...)) && static_cast<bool>(q(as...))))
+        -> decltype(static_cast<bool>(p(as...)) && static_cast<bool>(q(as...)))
+        {
+            return static_cast<bool>(p(as...)) && static_cast<bool>(q(as...));
+        }
+    };
+
+    struct us_or_t {
+        template < typename P, typename Q, typename... As >
+        KARI_HPP_INLINE constexpr auto operator()(const P& p, const Q& q, As&&... as) const
+        noexcept(noexcept(static_cast<bool>(p(as...)) || static_cast<bool>(q(as...))))
+        -> decltype(static_cast<bool>(p(as...)) || static_cast<bool>(q(as...)))
+        {
+            return static_cast<bool>(p(as...)) || static_cast<bool>(q(as...));
+        }
+    };
+
+    template < typename P, typename Q
+             , std::enable_if_t<std::conjunction_v<
+                is_curried<std::decay_t<P>>,
+                is_curried<std::decay_t<Q>>>, int> = 0 >
+    KARI_HPP_INLINE constexpr auto operator&&(P&& p, Q&& q)
+    noexcept(noexcept(curry(us_and_t{}, std::declval<P>(), std::declval<Q>())))
+    {
+        return curry(us_and_t{}, KARI_HPP_FWD(p), KARI_HPP_FWD(q));
+    }
+
+    template < typename P, typename Q
+             , std::enable_if_t<std::conjunction_v<
+                is_curried<std::decay_t<P>>,
+                is_curried<std::decay_t<Q>>>, int> = 0 >
+    KARI_HPP_INLINE constexpr auto operator||(P&& p, Q&& q)
+    noexcept(noexcept(curry(us_or_t{}, std::declval<P>(), std::declval<Q>())))
+    {
+        return curry(us_or_t{}, KARI_HPP_FWD(p), KARI_HPP_FWD(q));
+    }
 }
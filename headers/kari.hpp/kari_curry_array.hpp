@@ -0,0 +1,224 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/BlackMATov/kari.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2017-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "kari.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace kari_hpp::ext
+{
+    //
+    // curry_array
+    //
+    // A batch of partial applications of the same function that differ only
+    // in their bound arguments. The bound arguments are stored column-wise,
+    // and every member is evaluated against the same remaining arguments in
+    // one pass over the columns:
+    //
+    //   curry_array<decltype(_ < 0)> rules;
+    //   rules.push_back(_ < 10);
+    //   rules.push_back(_ < 20);
+    //   rules.eval(results, value); // results[i] = rules[i](value)
+    //
+    // All the members share the function of the array. It is passed to the
+    // constructor or taken from the first push_back, the next members should
+    // carry an equal function (checked when it has operator==, for example
+    // function pointers). emplace_back takes only the bound arguments, so it
+    // needs the function to be known unless it is an empty class.
+    //
+
+    template < typename C >
+    class curry_array;
+
+    template < typename F, typename... Args >
+    class curry_array<curry_t<F, Args...>> final {
+        static_assert(sizeof...(Args) > 0, "curry_array members should have bound arguments");
+    public:
+        using value_type = curry_t<F, Args...>;
+        using size_type = std::size_t;
+
+        static constexpr std::size_t mask_bits = 64;
+
+        curry_array() = default;
+
+        explicit curry_array(F f)
+        noexcept(std::is_nothrow_move_constructible_v<F>)
+        : f_(std::move(f)) {}
+
+        size_type size() const noexcept {
+            return std::get<0>(columns_).size();
+        }
+
+        bool empty() const noexcept {
+            return std::get<0>(columns_).empty();
+        }
+
+        void reserve(size_type capacity) {
+            std::apply([capacity](auto&... columns){
+                (columns.reserve(capacity), ...);
+            }, columns_);
+        }
+
+        void clear() noexcept {
+            std::apply([](auto&... columns){
+                (columns.clear(), ...);
+            }, columns_);
+        }
+
+        void push_back(const value_type& c) {
+            share_function_(detail::curry_access::function(c));
+            push_back_(c, std::index_sequence_for<Args...>());
+        }
+
+        template < typename... As >
+        void emplace_back(As&&... as) {
+            static_assert(sizeof...(As) == sizeof...(Args), "one value per bound argument");
+            if ( !f_ ) {
+                if constexpr ( std::is_empty_v<F> && std::is_default_constructible_v<F> ) {
+                    f_.emplace();
+                } else {
+                    throw std::logic_error("curry_array function is unknown, push_back a member first");
+                }
+            }
+            emplace_back_(std::index_sequence_for<Args...>(), std::forward<As>(as)...);
+        }
+
+        value_type operator[](size_type index) const {
+            return at_(index, std::index_sequence_for<Args...>());
+        }
+
+        template < std::size_t I >
+        const auto& column() const noexcept {
+            return std::get<I>(columns_);
+        }
+
+        //
+        // Writes `f(args_i..., as...)` of every member to out[0..size()).
+        //
+
+        template < typename OutIter, typename... As >
+        OutIter eval(OutIter out, const As&... as) const {
+            return eval_(std::index_sequence_for<Args...>(), out, as...);
+        }
+
+        //
+        // Sets bit `i % 64` of word `i / 64` to the result of the i-th member,
+        // `words` should hold (size() + 63) / 64 elements.
+        //
+
+        template < typename... As >
+        void eval_mask(std::uint64_t* words, const As&... as) const {
+            eval_mask_(std::index_sequence_for<Args...>(), words, as...);
+        }
+    private:
+        void share_function_(const F& f) {
+            if ( !f_ ) {
+                f_.emplace(f);
+            } else if constexpr ( detail::is_equality_comparable<F>::value ) {
+                if ( !static_cast<bool>(*f_ == f) ) {
+                    throw std::invalid_argument("curry_array members should share the function");
+                }
+            }
+        }
+
+        template < std::size_t... Is >
+        value_type at_(size_type index, std::index_sequence<Is...>) const {
+            return value_type(*f_, std::tuple<Args...>(std::get<Is>(columns_)[index]...));
+        }
+
+        template < std::size_t... Is >
+        void push_back_(const value_type& c, std::index_sequence<Is...> is) {
+            emplace_back_(is, detail::curry_access::arg<Is>(c)...);
+        }
+
+        template < std::size_t... Is, typename... As >
+        void emplace_back_(std::index_sequence<Is...>, As&&... as) {
+            (std::get<Is>(columns_).emplace_back(std::forward<As>(as)), ...);
+        }
+
+        template < typename... As >
+        static constexpr void check_result_() noexcept {
+            static_assert(
+                std::is_invocable_v<const F&, const Args&..., const As&...>,
+                "curry_array members should be saturated by the evaluation arguments");
+            static_assert(
+                !is_curried_v<std::decay_t<std::invoke_result_t<const F&, const Args&..., const As&...>>>,
+                "curry_array members should be saturated by the evaluation arguments");
+        }
+
+        template < std::size_t... Is, typename OutIter, typename... As >
+        OutIter eval_(std::index_sequence<Is...>, OutIter out, const As&... as) const {
+            check_result_<As...>();
+            if ( empty() ) {
+                return out;
+            }
+            // plain pointers, so the loop doesn't reload the vector internals
+            const std::tuple<const Args*...> data(std::get<Is>(columns_).data()...);
+            const F& f = *f_;
+            const size_type n = size();
+            for ( size_type i = 0; i < n; ++i, ++out ) {
+                *out = f(std::get<Is>(data)[i]..., as...);
+            }
+            return out;
+        }
+
+        template < std::size_t... Is, typename... As >
+        void eval_mask_(std::index_sequence<Is...>, std::uint64_t* words, const As&... as) const {
+            check_result_<As...>();
+            if ( empty() ) {
+                return;
+            }
+            const std::tuple<const Args*...> data(std::get<Is>(columns_).data()...);
+            const F& f = *f_;
+            const size_type n = size();
+
+            // the results go to bytes first, full blocks have a constant
+            // trip count, so the compilers vectorize them even at -O2
+            unsigned char block[mask_bits]{};
+
+            size_type first = 0;
+            for ( ; n - first >= mask_bits; first += mask_bits ) {
+                for ( size_type i = 0; i < mask_bits; ++i ) {
+                    block[i] = static_cast<bool>(f(std::get<Is>(data)[first + i]..., as...));
+                }
+                words[first / mask_bits] = pack_mask_(block);
+            }
+
+            if ( first < n ) {
+                for ( size_type i = 0; i < mask_bits; ++i ) {
+                    block[i] = first + i < n
+                        && static_cast<bool>(f(std::get<Is>(data)[first + i]..., as...));
+                }
+                words[first / mask_bits] = pack_mask_(block);
+            }
+        }
+
+        static std::uint64_t pack_mask_(const unsigned char (&block)[mask_bits]) noexcept {
+            // packs eight 0/1 bytes into eight bits with one multiplication
+            std::uint64_t word = 0;
+            for ( size_type i = 0; i < mask_bits; i += 8 ) {
+                std::uint64_t bytes = 0;
+                for ( size_type j = 0; j < 8; ++j ) {
+                    bytes |= static_cast<std::uint64_t>(block[i + j]) << (j * 8);
+                }
+                word |= ((bytes * 0x0102040810204080u) >> 56) << i;
+            }
+            return word;
+        }
+    private:
+        std::optional<F> f_;
+        std::tuple<std::vector<Args>...> columns_;
+    };
+}
@@ -0,0 +1,459 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/BlackMATov/kari.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2017-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "kari.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace kari_hpp::ext::dataflow
+{
+    //
+    // thread_pool
+    //
+    // Every worker owns a task queue. Tasks submitted from a worker go to
+    // its own queue (LIFO for locality), idle workers steal from the front
+    // of the other queues. The task counters are atomic, the pool mutex is
+    // taken only to put workers to sleep and to wake them up.
+    //
+
+    class thread_pool final {
+    public:
+        explicit thread_pool(std::size_t threads = std::thread::hardware_concurrency()) {
+            threads = std::max<std::size_t>(threads, 1);
+            queues_.reserve(threads);
+            for ( std::size_t i = 0; i < threads; ++i ) {
+                queues_.push_back(std::make_unique<queue_t>());
+            }
+            threads_.reserve(threads);
+            for ( std::size_t i = 0; i < threads; ++i ) {
+                threads_.emplace_back([this, i](){ worker_(i); });
+            }
+        }
+
+        ~thread_pool() noexcept {
+            {
+                std::lock_guard<std::mutex> guard(mutex_);
+                stop_ = true;
+            }
+            work_cv_.notify_all();
+            for ( std::thread& thread : threads_ ) {
+                thread.join();
+            }
+        }
+
+        thread_pool(thread_pool&&) = delete;
+        thread_pool& operator=(thread_pool&&) = delete;
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        std::size_t size() const noexcept {
+            return threads_.size();
+        }
+
+        bool is_worker_thread() const noexcept {
+            return current_worker_() == this;
+        }
+
+        void submit(std::function<void()> task) {
+            const std::size_t index = is_worker_thread()
+                ? current_index_()
+                : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+            {
+                queue_t& queue = *queues_[index];
+                std::lock_guard<std::mutex> guard(queue.mutex);
+                queue.tasks.push_back(std::move(task));
+            }
+            pending_.fetch_add(1);
+            queued_.fetch_add(1);
+
+            // a sleeper either sees the new task in its wait predicate,
+            // or is already waiting and gets the notification
+            if ( sleepers_.load() > 0 ) {
+                { std::lock_guard<std::mutex> guard(mutex_); }
+                work_cv_.notify_one();
+            }
+        }
+
+        void wait() {
+            std::unique_lock<std::mutex> lock(mutex_);
+            idle_cv_.wait(lock, [this](){ return pending_.load() == 0; });
+        }
+    private:
+        struct queue_t {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        static const thread_pool*& current_worker_() noexcept {
+            static thread_local const thread_pool* worker{};
+            return worker;
+        }
+
+        static std::size_t& current_index_() noexcept {
+            static thread_local std::size_t index{};
+            return index;
+        }
+
+        bool try_pop_(std::size_t index, std::function<void()>& task) {
+            {
+                queue_t& queue = *queues_[index];
+                std::lock_guard<std::mutex> guard(queue.mutex);
+                if ( !queue.tasks.empty() ) {
+                    task = std::move(queue.tasks.back());
+                    queue.tasks.pop_back();
+                    return true;
+                }
+            }
+            for ( std::size_t i = 1; i < queues_.size(); ++i ) {
+                queue_t& queue = *queues_[(index + i) % queues_.size()];
+                std::lock_guard<std::mutex> guard(queue.mutex);
+                if ( !queue.tasks.empty() ) {
+                    task = std::move(queue.tasks.front());
+                    queue.tasks.pop_front();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool try_reserve_() noexcept {
+            std::size_t queued = queued_.load();
+            while ( queued > 0 ) {
+                if ( queued_.compare_exchange_weak(queued, queued - 1) ) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void worker_(std::size_t index) {
+            current_worker_() = this;
+            current_index_() = index;
+            for (;;) {
+                if ( !try_reserve_() ) {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    sleepers_.fetch_add(1);
+                    work_cv_.wait(lock, [this](){ return stop_ || queued_.load() > 0; });
+                    sleepers_.fetch_sub(1);
+                    if ( stop_ && queued_.load() == 0 ) {
+                        return;
+                    }
+                    continue;
+                }
+
+                // there are at least as many queued tasks as reservations,
+                // so the search always succeeds after a few retries
+                std::function<void()> task;
+                while ( !try_pop_(index, task) ) {
+                    std::this_thread::yield();
+                }
+
+                task();
+
+                if ( pending_.fetch_sub(1) == 1 ) {
+                    { std::lock_guard<std::mutex> guard(mutex_); }
+                    idle_cv_.notify_all();
+                }
+            }
+        }
+    private:
+        std::vector<std::unique_ptr<queue_t>> queues_;
+        std::vector<std::thread> threads_;
+        std::atomic<std::size_t> next_queue_{0};
+        std::mutex mutex_;
+        std::condition_variable work_cv_;
+        std::condition_variable idle_cv_;
+        std::atomic<std::size_t> queued_{0};
+        std::atomic<std::size_t> pending_{0};
+        std::atomic<std::size_t> sleepers_{0};
+        bool stop_{false};
+    };
+}
+
+namespace kari_hpp::ext::dataflow
+{
+    class graph;
+
+    class node_base_t {
+    public:
+        virtual ~node_base_t() = default;
+    protected:
+        friend class graph;
+        virtual void start_() = 0;
+    };
+
+    //
+    // node_t
+    //
+    // A curried function with one slot per remaining argument. Every slot
+    // must be filled exactly once, by an edge or by set<I>(). Slots are
+    // written without locks: the producer that fills the last slot wins
+    // the atomic countdown and schedules the saturated function.
+    //
+    // A failed node passes its exception to the successors instead of a
+    // value, they finish without running and rethrow it from get().
+    //
+
+    template < typename F, typename... Args >
+    class node_t final : public node_base_t {
+    public:
+        using result_type = decltype(detail::curry_or_apply(
+            std::declval<F>(),
+            std::declval<detail::curry_args_t<Args...>>()));
+
+        static_assert(
+            !is_curried_v<result_type>,
+            "node function should be saturated by its slot arguments");
+
+        node_t(F f, thread_pool& pool)
+        : f_(std::move(f))
+        , pool_(pool) {}
+
+        template < std::size_t I, typename A >
+        void set(A&& a) {
+            std::get<I>(slots_).emplace(std::forward<A>(a));
+            count_down_();
+        }
+
+        bool ready() const noexcept {
+            return done_.load(std::memory_order_acquire);
+        }
+
+        const result_type& get() const {
+            if ( !ready() ) {
+                throw std::logic_error("dataflow node is not finished");
+            }
+            if ( error_ ) {
+                std::rethrow_exception(error_);
+            }
+            return *result_;
+        }
+    private:
+        friend class graph;
+
+        struct successor_t {
+            std::function<void(const result_type&)> value;
+            std::function<void(std::exception_ptr)> error;
+        };
+
+        void fail_(std::exception_ptr error) {
+            // only the first failed producer writes the error, the write
+            // is published to run_() by the countdown
+            if ( !failed_.exchange(true, std::memory_order_relaxed) ) {
+                error_ = std::move(error);
+            }
+            count_down_();
+        }
+
+        void count_down_() {
+            if ( pending_.fetch_sub(1, std::memory_order_acq_rel) == 1 ) {
+                pool_.submit([this](){ run_(); });
+            }
+        }
+
+        void start_() override {
+            if constexpr ( sizeof...(Args) == 0 ) {
+                pool_.submit([this](){ run_(); });
+            }
+        }
+
+        template < std::size_t... Is >
+        result_type apply_(std::index_sequence<Is...>) {
+            return detail::curry_or_apply(
+                std::move(f_),
+                detail::curry_args_t<Args...>{{std::move(*std::get<Is>(slots_))}...});
+        }
+
+        void run_() {
+            if ( !error_ ) {
+                try {
+                    result_.emplace(apply_(std::index_sequence_for<Args...>()));
+                } catch (...) {
+                    error_ = std::current_exception();
+                }
+            }
+
+            // every successor gets a value or an error, a successor that
+            // fails to take the value (e.g. copying it throws) gets the error
+            for ( const successor_t& successor : successors_ ) {
+                if ( !result_ ) {
+                    successor.error(error_);
+                    continue;
+                }
+                try {
+                    successor.value(*result_);
+                } catch (...) {
+                    successor.error(std::current_exception());
+                }
+            }
+
+            done_.store(true, std::memory_order_release);
+        }
+    private:
+        F f_;
+        thread_pool& pool_;
+        std::tuple<std::optional<Args>...> slots_;
+        std::atomic<std::size_t> pending_{sizeof...(Args)};
+        std::atomic<bool> failed_{false};
+        std::atomic<bool> done_{false};
+        std::optional<result_type> result_;
+        std::exception_ptr error_;
+        std::vector<successor_t> successors_;
+    };
+
+    //
+    // graph
+    //
+    // Owns the nodes and their edges. The graph should be fully built
+    // before the first slot is filled or run() is called, and it should
+    // outlive the execution (see wait()).
+    //
+
+    class graph final {
+    public:
+        explicit graph(thread_pool& pool)
+        : pool_(pool) {}
+
+        template < typename... Args, typename F >
+        node_t<std::decay_t<F>, Args...>& node(F&& f) {
+            auto node = std::make_unique<node_t<std::decay_t<F>, Args...>>(
+                std::forward<F>(f),
+                pool_);
+            auto& node_ref = *node;
+            nodes_.push_back(std::move(node));
+            return node_ref;
+        }
+
+        template < std::size_t I, typename F, typename... FArgs, typename G, typename... GArgs >
+        void connect(node_t<F, FArgs...>& from, node_t<G, GArgs...>& to) {
+            from.successors_.push_back({
+                [&to](const auto& result){ to.template set<I>(result); },
+                [&to](std::exception_ptr error){ to.fail_(std::move(error)); }});
+        }
+
+        void run() {
+            for ( const auto& node : nodes_ ) {
+                node->start_();
+            }
+        }
+
+        void wait() {
+            pool_.wait();
+        }
+    private:
+        thread_pool& pool_;
+        std::vector<std::unique_ptr<node_base_t>> nodes_;
+    };
+}
+
+namespace kari_hpp::ext::dataflow
+{
+    //
+    // parallel_reduce
+    //
+    // freduce over contiguous chunks of a random access range on the pool
+    // workers, the partial results are combined in order. Only associative
+    // functions are split; small ranges, non-associative functions and
+    // calls from the pool workers themselves fall back to freduce.
+    //
+
+    inline constexpr std::size_t parallel_reduce_min_chunk = 4096;
+
+    template < typename F, typename T, typename R >
+    auto parallel_reduce(thread_pool& pool, F&& f, T&& init, R&& range) {
+        using std::begin;
+        using std::end;
+        using iter_t = decltype(begin(range));
+        using value_t = std::decay_t<T>;
+
+        if constexpr ( is_associative_v<std::decay_t<F>>
+            && kari_hpp::detail::is_random_access_iterator_v<iter_t> )
+        {
+            const iter_t first = begin(range);
+            const auto size = static_cast<std::size_t>(end(range) - first);
+            const std::size_t chunks = std::min(pool.size(), size / parallel_reduce_min_chunk);
+
+            if ( chunks > 1 && !pool.is_worker_thread() ) {
+                std::vector<std::optional<value_t>> partials(chunks);
+                std::vector<std::exception_ptr> errors(chunks);
+
+                const auto reduce_chunk = [&f, &partials, &errors, first, size, chunks](std::size_t i){
+                    try {
+                        const iter_t chunk_first = first + static_cast<std::ptrdiff_t>(size * i / chunks);
+                        const iter_t chunk_last = first + static_cast<std::ptrdiff_t>(size * (i + 1) / chunks);
+                        partials[i].emplace(kari_hpp::detail::tree_reduce_range<value_t>(
+                            f, chunk_first, chunk_last));
+                    } catch (...) {
+                        errors[i] = std::current_exception();
+                    }
+                };
+
+                std::mutex mutex;
+                std::condition_variable done_cv;
+                std::size_t remaining = chunks - 1;
+
+                std::size_t submitted = 1;
+                try {
+                    for ( ; submitted < chunks; ++submitted ) {
+                        pool.submit([&reduce_chunk, &mutex, &done_cv, &remaining, i = submitted](){
+                            reduce_chunk(i);
+                            std::lock_guard<std::mutex> guard(mutex);
+                            if ( --remaining == 0 ) {
+                                done_cv.notify_one();
+                            }
+                        });
+                    }
+                } catch (...) {
+                    // the queued chunks reference the locals, so they
+                    // should finish before the stack is unwound
+                    std::unique_lock<std::mutex> lock(mutex);
+                    remaining -= chunks - submitted;
+                    done_cv.wait(lock, [&remaining](){ return remaining == 0; });
+                    throw;
+                }
+
+                reduce_chunk(0);
+
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    done_cv.wait(lock, [&remaining](){ return remaining == 0; });
+                }
+
+                for ( const std::exception_ptr& error : errors ) {
+                    if ( error ) {
+                        std::rethrow_exception(error);
+                    }
+                }
+
+                value_t result(std::forward<T>(init));
+                for ( std::optional<value_t>& partial : partials ) {
+                    result = f(std::move(result), std::move(*partial));
+                }
+                return result;
+            }
+        }
+
+        return value_t(freduce_t{}(std::forward<F>(f), std::forward<T>(init), std::forward<R>(range)));
+    }
+}
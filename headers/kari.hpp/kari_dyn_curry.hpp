@@ -0,0 +1,493 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/BlackMATov/kari.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2017-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "kari.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace kari_hpp
+{
+    class bad_dyn_curry_call final : public std::exception {
+    public:
+        const char* what() const noexcept override {
+            return "bad dyn_curry call";
+        }
+    };
+
+    class bad_dyn_curry_copy final : public std::exception {
+    public:
+        const char* what() const noexcept override {
+            return "bad dyn_curry copy";
+        }
+    };
+}
+
+namespace kari_hpp::detail
+{
+    //
+    // dyn_type_id
+    //
+    // Unique address per type, no RTTI required.
+    //
+
+    template < typename T >
+    struct dyn_type_tag {
+        static constexpr char id{};
+    };
+
+    template < typename T >
+    inline constexpr const void* dyn_type_id = &dyn_type_tag<T>::id;
+
+    template < typename T >
+    using dyn_storage_t = std::remove_cv_t<std::remove_reference_t<T>>;
+
+    //
+    // dyn_signature
+    //
+    // Member function pointers take their object as the first argument,
+    // function objects are described by their call operators without it.
+    //
+
+    template < typename R, typename... Args >
+    struct dyn_signature_impl {
+        using type = R(Args...);
+    };
+
+    template < typename M >
+    struct dyn_call_operator_signature {};
+
+    template < typename C, typename R, typename... Args >
+    struct dyn_call_operator_signature<R(C::*)(Args...)> : dyn_signature_impl<R, Args...> {};
+
+    template < typename C, typename R, typename... Args >
+    struct dyn_call_operator_signature<R(C::*)(Args...) noexcept> : dyn_signature_impl<R, Args...> {};
+
+    template < typename C, typename R, typename... Args >
+    struct dyn_call_operator_signature<R(C::*)(Args...) const> : dyn_signature_impl<R, Args...> {};
+
+    template < typename C, typename R, typename... Args >
+    struct dyn_call_operator_signature<R(C::*)(Args...) const noexcept> : dyn_signature_impl<R, Args...> {};
+
+    template < typename F, typename = void >
+    struct dyn_signature {};
+
+    template < typename R, typename... Args >
+    struct dyn_signature<R(*)(Args...)> : dyn_signature_impl<R, Args...> {};
+
+    template < typename R, typename... Args >
+    struct dyn_signature<R(*)(Args...) noexcept> : dyn_signature_impl<R, Args...> {};
+
+    template < typename C, typename R, typename... Args >
+    struct dyn_signature<R(C::*)(Args...)> : dyn_signature_impl<R, C&, Args...> {};
+
+    template < typename C, typename R, typename... Args >
+    struct dyn_signature<R(C::*)(Args...) noexcept> : dyn_signature_impl<R, C&, Args...> {};
+
+    template < typename C, typename R, typename... Args >
+    struct dyn_signature<R(C::*)(Args...) const> : dyn_signature_impl<R, const C&, Args...> {};
+
+    template < typename C, typename R, typename... Args >
+    struct dyn_signature<R(C::*)(Args...) const noexcept> : dyn_signature_impl<R, const C&, Args...> {};
+
+    template < typename F >
+    struct dyn_signature<F, std::void_t<decltype(&F::operator())>>
+    : dyn_call_operator_signature<decltype(&F::operator())> {};
+
+    //
+    // dyn_object_ops
+    //
+
+    // `copy` is null for move-only types
+
+    struct dyn_object_ops {
+        const void* type;
+        std::size_t offset;
+        void (*copy)(const void* from, void* to);
+        void (*move)(void* from, void* to) noexcept;
+        void (*destroy)(void* object) noexcept;
+    };
+
+    template < typename T >
+    void dyn_copy(const void* from, void* to) {
+        ::new (to) T(*static_cast<const T*>(from));
+    }
+
+    template < typename T >
+    void dyn_move(void* from, void* to) noexcept {
+        ::new (to) T(std::move(*static_cast<T*>(from)));
+    }
+
+    template < typename T >
+    void dyn_destroy(void* object) noexcept {
+        static_cast<T*>(object)->~T();
+    }
+
+    template < typename T >
+    constexpr dyn_object_ops make_dyn_object_ops(std::size_t offset) noexcept {
+        if constexpr ( std::is_copy_constructible_v<T> ) {
+            return {dyn_type_id<T>, offset, &dyn_copy<T>, &dyn_move<T>, &dyn_destroy<T>};
+        } else {
+            return {dyn_type_id<T>, offset, nullptr, &dyn_move<T>, &dyn_destroy<T>};
+        }
+    }
+
+    // Stored arguments are passed as lvalues, so the closure can be called
+    // again. Rvalue reference and move-only by-value parameters get them
+    // as rvalues instead.
+
+    template < typename A >
+    decltype(auto) dyn_stored_arg(std::byte* p) noexcept {
+        using T = dyn_storage_t<A>;
+        T& stored = *std::launder(reinterpret_cast<T*>(p));
+        if constexpr ( std::is_rvalue_reference_v<A>
+            || (!std::is_reference_v<A> && !std::is_copy_constructible_v<T>) )
+        {
+            return std::move(stored);
+        } else {
+            return stored;
+        }
+    }
+
+    //
+    // dyn_vtable
+    //
+    // One static table per wrapped function and signature: argument
+    // layout and ops, and the invocation thunk.
+    //
+
+    struct dyn_vtable {
+        dyn_object_ops function;
+        std::size_t function_size;
+        std::size_t function_align;
+        bool function_inline;
+
+        const dyn_object_ops* args;
+        std::size_t arity;
+        std::size_t args_size;
+        std::size_t args_align;
+        bool args_inline;
+
+        bool copyable;
+        const void* result;
+        void (*invoke)(void* f, std::byte* args, void* result);
+    };
+
+    template < typename F, typename Sig, std::size_t FunctionCapacity, std::size_t ArgsCapacity >
+    struct dyn_vtable_for;
+
+    template < typename F, typename R, typename... Args
+             , std::size_t FunctionCapacity, std::size_t ArgsCapacity >
+    struct dyn_vtable_for<F, R(Args...), FunctionCapacity, ArgsCapacity> {
+        static constexpr std::size_t arity = sizeof...(Args);
+
+        static constexpr std::array<std::size_t, arity + 1> offsets = [](){
+            constexpr std::size_t sizes[] = {sizeof(dyn_storage_t<Args>)..., 0};
+            constexpr std::size_t aligns[] = {alignof(dyn_storage_t<Args>)..., 1};
+            std::array<std::size_t, arity + 1> result{};
+            std::size_t offset = 0;
+            for ( std::size_t i = 0; i < arity; ++i ) {
+                offset = (offset + aligns[i] - 1) / aligns[i] * aligns[i];
+                result[i] = offset;
+                offset += sizes[i];
+            }
+            result[arity] = offset;
+            return result;
+        }();
+
+        static constexpr std::size_t args_align = std::max({
+            alignof(std::byte), alignof(dyn_storage_t<Args>)...});
+
+        static constexpr bool args_inline =
+            offsets[arity] <= ArgsCapacity &&
+            args_align <= alignof(std::max_align_t) &&
+            std::conjunction_v<std::is_nothrow_move_constructible<dyn_storage_t<Args>>...>;
+
+        static constexpr bool function_inline =
+            sizeof(F) <= FunctionCapacity &&
+            alignof(F) <= alignof(std::max_align_t) &&
+            std::is_nothrow_move_constructible_v<F>;
+
+        template < std::size_t... Is >
+        static constexpr std::array<dyn_object_ops, arity> make_args(std::index_sequence<Is...>) noexcept {
+            return {{make_dyn_object_ops<dyn_storage_t<Args>>(offsets[Is])...}};
+        }
+
+        static constexpr std::array<dyn_object_ops, arity> args =
+            make_args(std::index_sequence_for<Args...>());
+
+        template < std::size_t... Is >
+        static R invoke_impl(void* f, std::byte* as, std::index_sequence<Is...>) {
+            return std::invoke(
+                *static_cast<F*>(f),
+                dyn_stored_arg<Args>(as + offsets[Is])...);
+        }
+
+        static void invoke(void* f, std::byte* as, [[maybe_unused]] void* result) {
+            if constexpr ( std::is_void_v<R> ) {
+                invoke_impl(f, as, std::index_sequence_for<Args...>());
+            } else {
+                static_cast<std::optional<dyn_storage_t<R>>*>(result)->emplace(
+                    invoke_impl(f, as, std::index_sequence_for<Args...>()));
+            }
+        }
+
+        static constexpr dyn_vtable value{
+            make_dyn_object_ops<F>(0), sizeof(F), alignof(F), function_inline,
+            args.data(), arity, offsets[arity], args_align, args_inline,
+            std::conjunction_v<std::is_copy_constructible<F>, std::is_copy_constructible<dyn_storage_t<Args>>...>,
+            dyn_type_id<dyn_storage_t<R>>,
+            &invoke};
+    };
+}
+
+namespace kari_hpp
+{
+    //
+    // dyn_curry
+    //
+    // Runtime currying of a typed function. Arguments are bound one at a
+    // time and type-checked against the signature; they are stored in an
+    // inline buffer, so small signatures do not allocate. The heap is
+    // used once per closure only for oversized functions or arguments.
+    //
+    // Closures of move-only functions or argument types can be moved,
+    // copying them throws bad_dyn_curry_copy (see copyable()).
+    //
+
+    class dyn_curry final {
+    public:
+        static constexpr std::size_t function_capacity = 4 * sizeof(void*);
+        static constexpr std::size_t args_capacity = 8 * sizeof(void*);
+
+        template < typename F
+                 , typename Sig = typename detail::dyn_signature<std::decay_t<F>>::type
+                 , std::enable_if_t<!std::is_same_v<std::decay_t<F>, dyn_curry>, int> = 0 >
+        dyn_curry(F&& f)
+        : dyn_curry(vtable_for_<std::decay_t<F>, Sig>(), std::forward<F>(f)) {}
+
+        template < typename R, typename... Args, typename F >
+        static dyn_curry make(F&& f) {
+            return dyn_curry(vtable_for_<std::decay_t<F>, R(Args...)>(), std::forward<F>(f));
+        }
+
+        dyn_curry(const dyn_curry& other)
+        : vtable_(other.vtable_) {
+            if ( !vtable_ ) {
+                return;
+            }
+            if ( !vtable_->copyable ) {
+                throw bad_dyn_curry_copy();
+            }
+            allocate_();
+            try {
+                vtable_->function.copy(other.function_, function_);
+                try {
+                    for ( ; bound_ < other.bound_; ++bound_ ) {
+                        const detail::dyn_object_ops& arg = vtable_->args[bound_];
+                        arg.copy(other.args_ + arg.offset, args_ + arg.offset);
+                    }
+                } catch (...) {
+                    destroy_args_();
+                    vtable_->function.destroy(function_);
+                    throw;
+                }
+            } catch (...) {
+                deallocate_();
+                throw;
+            }
+        }
+
+        dyn_curry(dyn_curry&& other) noexcept
+        : vtable_(other.vtable_) {
+            if ( !vtable_ ) {
+                return;
+            }
+
+            if ( vtable_->function_inline ) {
+                function_ = function_buffer_;
+                vtable_->function.move(other.function_, function_);
+                vtable_->function.destroy(other.function_);
+            } else {
+                function_ = other.function_;
+            }
+
+            if ( vtable_->args_inline ) {
+                args_ = args_buffer_;
+                for ( ; bound_ < other.bound_; ++bound_ ) {
+                    const detail::dyn_object_ops& arg = vtable_->args[bound_];
+                    arg.move(other.args_ + arg.offset, args_ + arg.offset);
+                }
+                other.destroy_args_();
+            } else {
+                args_ = other.args_;
+                bound_ = other.bound_;
+            }
+
+            other.vtable_ = nullptr;
+            other.function_ = nullptr;
+            other.args_ = nullptr;
+            other.bound_ = 0;
+        }
+
+        dyn_curry& operator=(const dyn_curry& other) {
+            if ( this != &other ) {
+                dyn_curry copy(other);
+                this->~dyn_curry();
+                ::new (this) dyn_curry(std::move(copy));
+            }
+            return *this;
+        }
+
+        dyn_curry& operator=(dyn_curry&& other) noexcept {
+            if ( this != &other ) {
+                this->~dyn_curry();
+                ::new (this) dyn_curry(std::move(other));
+            }
+            return *this;
+        }
+
+        ~dyn_curry() noexcept {
+            if ( vtable_ ) {
+                destroy_args_();
+                vtable_->function.destroy(function_);
+                deallocate_();
+            }
+        }
+
+        std::size_t arity() const noexcept {
+            return vtable_ ? vtable_->arity : 0;
+        }
+
+        std::size_t bound() const noexcept {
+            return bound_;
+        }
+
+        bool saturated() const noexcept {
+            return vtable_ && bound_ == vtable_->arity;
+        }
+
+        bool copyable() const noexcept {
+            return !vtable_ || vtable_->copyable;
+        }
+
+        template < typename A >
+        bool accepts() const noexcept {
+            return vtable_
+                && bound_ < vtable_->arity
+                && vtable_->args[bound_].type == detail::dyn_type_id<detail::dyn_storage_t<A>>;
+        }
+
+        template < typename R >
+        bool returns() const noexcept {
+            return vtable_
+                && vtable_->result == detail::dyn_type_id<detail::dyn_storage_t<R>>;
+        }
+
+        // Binds the next argument. Returns false without side effects if
+        // all arguments are bound or `a` has a different type.
+        template < typename A >
+        [[nodiscard]] bool bind(A&& a) {
+            using arg_t = detail::dyn_storage_t<A>;
+            if ( !accepts<arg_t>() ) {
+                return false;
+            }
+            ::new (args_ + vtable_->args[bound_].offset) arg_t(std::forward<A>(a));
+            ++bound_;
+            return true;
+        }
+
+        // Calls the function with the bound arguments, the closure stays
+        // saturated and can be called again. Throws bad_dyn_curry_call if
+        // the closure is not saturated or `R` is not its result type.
+        // Results are returned by value, even for functions returning
+        // references: invoke<std::string>() for `const std::string& f()`.
+        template < typename R >
+        R invoke() {
+            static_assert(
+                !std::is_reference_v<R>,
+                "dyn_curry results are returned by value, invoke them without a reference");
+            if ( !saturated() || !returns<R>() ) {
+                throw bad_dyn_curry_call();
+            }
+            if constexpr ( std::is_void_v<R> ) {
+                vtable_->invoke(function_, args_, nullptr);
+            } else {
+                std::optional<detail::dyn_storage_t<R>> result;
+                vtable_->invoke(function_, args_, &result);
+                return std::move(*result);
+            }
+        }
+    private:
+        template < typename F, typename Sig >
+        static const detail::dyn_vtable* vtable_for_() noexcept {
+            return &detail::dyn_vtable_for<F, Sig, function_capacity, args_capacity>::value;
+        }
+
+        template < typename F >
+        dyn_curry(const detail::dyn_vtable* vtable, F&& f)
+        : vtable_(vtable) {
+            allocate_();
+            try {
+                ::new (function_) std::decay_t<F>(std::forward<F>(f));
+            } catch (...) {
+                deallocate_();
+                throw;
+            }
+        }
+
+        void allocate_() {
+            function_ = vtable_->function_inline
+                ? static_cast<void*>(function_buffer_)
+                : ::operator new(vtable_->function_size, std::align_val_t(vtable_->function_align));
+
+            try {
+                args_ = vtable_->args_inline
+                    ? args_buffer_
+                    : static_cast<std::byte*>(::operator new(
+                        std::max<std::size_t>(vtable_->args_size, 1),
+                        std::align_val_t(vtable_->args_align)));
+            } catch (...) {
+                if ( !vtable_->function_inline ) {
+                    ::operator delete(function_, std::align_val_t(vtable_->function_align));
+                }
+                throw;
+            }
+        }
+
+        void deallocate_() noexcept {
+            if ( !vtable_->function_inline ) {
+                ::operator delete(function_, std::align_val_t(vtable_->function_align));
+            }
+            if ( !vtable_->args_inline ) {
+                ::operator delete(args_, std::align_val_t(vtable_->args_align));
+            }
+        }
+
+        void destroy_args_() noexcept {
+            for ( ; bound_ > 0; --bound_ ) {
+                const detail::dyn_object_ops& arg = vtable_->args[bound_ - 1];
+                arg.destroy(args_ + arg.offset);
+            }
+        }
+    private:
+        const detail::dyn_vtable* vtable_{};
+        void* function_{};
+        std::byte* args_{};
+        std::size_t bound_{};
+        alignas(std::max_align_t) std::byte function_buffer_[function_capacity];
+        alignas(std::max_align_t) std::byte args_buffer_[args_capacity];
+    };
+}
@@ -0,0 +1,355 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/BlackMATov/kari.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2017-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "kari.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace kari_hpp::ext::incremental
+{
+    template < typename T >
+    class cell;
+
+    template < typename F, typename... Inputs >
+    class node_t;
+}
+
+namespace kari_hpp::detail
+{
+    //
+    // incremental passes
+    //
+    // Every get() of a node is a pass with a unique number. A node shared
+    // by several paths is validated once per pass, the next pulls in the
+    // same pass return its version at once. The counter only hands out
+    // numbers, the graphs don't share any other state.
+    //
+
+    inline std::atomic<std::uint64_t> incremental_pass_counter{0};
+
+    inline std::uint64_t next_incremental_pass() noexcept {
+        return incremental_pass_counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    struct incremental_access {
+        template < typename N >
+        static std::uint64_t pull(N& node, std::uint64_t pass) {
+            node.validate_(pass);
+            return node.version_;
+        }
+
+        template < typename N >
+        static const auto& value(const N& node) noexcept {
+            return *node.result_;
+        }
+    };
+
+    //
+    // incremental inputs
+    //
+    // pull(pass) brings the input up to date and returns its version,
+    // value() returns the value as of the last pull.
+    //
+
+    template < typename T >
+    class incremental_cell_input final {
+    public:
+        explicit incremental_cell_input(const ext::incremental::cell<T>& cell) noexcept
+        : cell_(&cell) {}
+
+        std::uint64_t pull(std::uint64_t) const noexcept {
+            return cell_->version();
+        }
+
+        const T& value() const noexcept {
+            return cell_->get();
+        }
+    private:
+        const ext::incremental::cell<T>* cell_;
+    };
+
+    template < typename N >
+    class incremental_node_ref_input final {
+    public:
+        explicit incremental_node_ref_input(N& node) noexcept
+        : node_(&node) {}
+
+        std::uint64_t pull(std::uint64_t pass) const {
+            return incremental_access::pull(*node_, pass);
+        }
+
+        const auto& value() const noexcept {
+            return incremental_access::value(*node_);
+        }
+    private:
+        N* node_;
+    };
+
+    template < typename N >
+    class incremental_node_input final {
+    public:
+        explicit incremental_node_input(N&& node)
+        : node_(std::move(node)) {}
+
+        std::uint64_t pull(std::uint64_t pass) {
+            return incremental_access::pull(node_, pass);
+        }
+
+        const auto& value() const noexcept {
+            return incremental_access::value(node_);
+        }
+    private:
+        N node_;
+    };
+
+    template < typename V >
+    class incremental_const_input final {
+    public:
+        template < typename A >
+        explicit incremental_const_input(A&& a)
+        : value_(std::forward<A>(a)) {}
+
+        std::uint64_t pull(std::uint64_t) const noexcept {
+            return 0;
+        }
+
+        const V& value() const noexcept {
+            return value_;
+        }
+    private:
+        V value_;
+    };
+
+    template < typename A >
+    struct incremental_input {
+        using type = incremental_const_input<std::decay_t<A>>;
+    };
+
+    template < typename T >
+    struct incremental_input<ext::incremental::cell<T>&> {
+        using type = incremental_cell_input<T>;
+    };
+
+    template < typename T >
+    struct incremental_input<const ext::incremental::cell<T>&> {
+        using type = incremental_cell_input<T>;
+    };
+
+    template < typename F, typename... Inputs >
+    struct incremental_input<ext::incremental::node_t<F, Inputs...>&> {
+        using type = incremental_node_ref_input<ext::incremental::node_t<F, Inputs...>>;
+    };
+
+    template < typename F, typename... Inputs >
+    struct incremental_input<const ext::incremental::node_t<F, Inputs...>&> {
+        // a copy would stop tracking the cells of the node
+        static_assert(
+            !std::is_same_v<F, F>,
+            "const nodes can't be updated, pass a node as a non-const lvalue");
+    };
+
+    template < typename F, typename... Inputs >
+    struct incremental_input<ext::incremental::node_t<F, Inputs...>> {
+        using type = incremental_node_input<ext::incremental::node_t<F, Inputs...>>;
+    };
+
+    template < typename A >
+    using incremental_input_t = typename incremental_input<A>::type;
+}
+
+namespace kari_hpp::ext::incremental
+{
+    //
+    // cell
+    //
+    // An observable source value. Nodes that depend on a cell recompute
+    // their results on the next get() after the cell is changed.
+    //
+
+    template < typename T >
+    class cell final {
+    public:
+        using value_type = T;
+
+        explicit cell(T value)
+        noexcept(std::is_nothrow_move_constructible_v<T>)
+        : value_(std::move(value)) {}
+
+        cell(const cell&) = delete;
+        cell& operator=(const cell&) = delete;
+
+        const T& get() const noexcept {
+            return value_;
+        }
+
+        std::uint64_t version() const noexcept {
+            return version_;
+        }
+
+        void set(T value) {
+            if constexpr ( detail::is_equality_comparable<T>::value ) {
+                if ( value_ == value ) {
+                    return;
+                }
+            }
+            value_ = std::move(value);
+            mark_dirty();
+        }
+
+        template < typename F >
+        void modify(F&& f) {
+            std::forward<F>(f)(value_);
+            mark_dirty();
+        }
+
+        void mark_dirty() noexcept {
+            ++version_;
+        }
+    private:
+        T value_;
+        std::uint64_t version_{1};
+    };
+
+    //
+    // node_t
+    //
+    // A saturated function of cells, other nodes and constant values that
+    // caches its result. get() pulls the inputs first (so the graph is
+    // updated in topological order and every node sees consistent inputs)
+    // and recomputes the result only when an input version has changed.
+    // A recomputed result equal to the cached one keeps the node version,
+    // so the downstream nodes are not recomputed.
+    //
+    // Nodes passed as lvalues are referenced and should outlive their
+    // dependents, the other inputs are owned. A graph is not thread safe,
+    // but nodes share no state with other graphs, so separate graphs can
+    // be used from different threads.
+    //
+
+    template < typename F, typename... Inputs >
+    class node_t final {
+    public:
+        using result_type = std::decay_t<std::invoke_result_t<
+            const F&,
+            decltype(std::declval<Inputs&>().value())...>>;
+
+        static_assert(
+            !is_curried_v<result_type>,
+            "node function should be saturated by its inputs");
+
+        template < typename... As >
+        explicit node_t(F f, As&&... as)
+        : f_(std::move(f))
+        , inputs_(std::forward<As>(as)...) {}
+
+        const result_type& get() {
+            validate_(detail::next_incremental_pass());
+            return *result_;
+        }
+
+        const result_type& operator()() {
+            return get();
+        }
+
+        std::uint64_t version() {
+            get();
+            return version_;
+        }
+    private:
+        friend struct detail::incremental_access;
+
+        void validate_(std::uint64_t pass) {
+            if ( validated_pass_ != pass ) {
+                update_(pass, std::index_sequence_for<Inputs...>());
+                validated_pass_ = pass;
+            }
+        }
+
+        template < std::size_t... Is >
+        void update_(std::uint64_t pass, std::index_sequence<Is...>) {
+            const std::array<std::uint64_t, sizeof...(Inputs)> versions{
+                std::get<Is>(inputs_).pull(pass)...};
+
+            if ( result_ && versions == input_versions_ ) {
+                return;
+            }
+
+            const F& f = f_;
+            result_type result = f(std::get<Is>(inputs_).value()...);
+
+            input_versions_ = versions;
+            if constexpr ( detail::is_equality_comparable<result_type>::value ) {
+                if ( result_ && *result_ == result ) {
+                    return;
+                }
+            }
+
+            result_ = std::move(result);
+            ++version_;
+        }
+    private:
+        F f_;
+        std::tuple<Inputs...> inputs_;
+        std::optional<result_type> result_;
+        std::array<std::uint64_t, sizeof...(Inputs)> input_versions_{};
+        std::uint64_t version_{0};
+        std::uint64_t validated_pass_{0};
+    };
+}
+
+namespace kari_hpp::detail
+{
+    template < typename F, typename... As >
+    auto make_incremental_node(F f, As&&... as) {
+        return ext::incremental::node_t<F, incremental_input_t<As>...>(
+            std::move(f),
+            std::forward<As>(as)...);
+    }
+
+    template < std::size_t I, typename Stages, typename Upstream >
+    auto make_incremental_chain(Stages& stages, Upstream&& upstream) {
+        if constexpr ( I == std::tuple_size_v<Stages> ) {
+            return std::forward<Upstream>(upstream);
+        } else {
+            return make_incremental_chain<I + 1>(
+                stages,
+                make_incremental_node(std::move(std::get<I>(stages)), std::forward<Upstream>(upstream)));
+        }
+    }
+}
+
+namespace kari_hpp::ext::incremental
+{
+    //
+    // node
+    //
+    // `node(f, inputs...)` makes a caching node of f. An fpipe or fcompose
+    // composition becomes a chain of nodes, one per stage, so a change stops
+    // at the first stage whose result stays the same:
+    //
+    //   cell<std::string> path{"a.txt"};
+    //   auto size = node(curry(read_file) | curry(parse) | curry(count), path);
+    //   size.get(); // the stages run once
+    //   size.get(); // cached
+    //
+
+    template < typename F, typename... As >
+    auto node(F&& f, As&&... as) {
+        auto stages = detail::composition_stages<std::decay_t<F>>::split(f);
+        return detail::make_incremental_chain<1>(
+            stages,
+            detail::make_incremental_node(std::move(std::get<0>(stages)), std::forward<As>(as)...));
+    }
+}
@@ -0,0 +1,374 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/BlackMATov/kari.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2017-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "kari.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <new>
+#include <optional>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace kari_hpp::detail
+{
+    //
+    // pipeline_backoff_t
+    //
+    // Waiting strategy of the pipeline queues: yields for a while, then
+    // sleeps in short steps, so idle stages don't burn whole cores.
+    //
+
+    class pipeline_backoff_t final {
+    public:
+        void operator()() {
+            if ( spins_ < 64 ) {
+                ++spins_;
+                std::this_thread::yield();
+            } else {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+
+        void reset() noexcept {
+            spins_ = 0;
+        }
+    private:
+        unsigned spins_{0};
+    };
+
+    //
+    // pipeline_queue_t
+    //
+    // Bounded lock-free single-producer single-consumer ring buffer. The
+    // producer closes the queue after the last item, the consumer sees
+    // the end when the queue is closed and empty.
+    //
+
+    template < typename T, std::size_t Capacity >
+    class pipeline_queue_t final {
+        static_assert(
+            Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+            "pipeline queue capacity should be a power of two");
+    public:
+        pipeline_queue_t() = default;
+
+        ~pipeline_queue_t() noexcept {
+            for ( std::size_t i = head_.load(); i != tail_.load(); ++i ) {
+                slot_(i)->~T();
+            }
+        }
+
+        pipeline_queue_t(const pipeline_queue_t&) = delete;
+        pipeline_queue_t& operator=(const pipeline_queue_t&) = delete;
+
+        template < typename A >
+        bool try_push(A&& a) {
+            const std::size_t tail = tail_.load(std::memory_order_relaxed);
+            if ( tail - head_cache_ == Capacity ) {
+                head_cache_ = head_.load(std::memory_order_acquire);
+                if ( tail - head_cache_ == Capacity ) {
+                    return false;
+                }
+            }
+            ::new (static_cast<void*>(slots_[tail & (Capacity - 1)].data)) T(std::forward<A>(a));
+            tail_.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool try_pop(std::optional<T>& out) {
+            const std::size_t head = head_.load(std::memory_order_relaxed);
+            if ( head == tail_cache_ ) {
+                tail_cache_ = tail_.load(std::memory_order_acquire);
+                if ( head == tail_cache_ ) {
+                    return false;
+                }
+            }
+            T* item = slot_(head);
+            out.emplace(std::move(*item));
+            item->~T();
+            head_.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        template < typename A >
+        bool push_wait(A&& a, const std::atomic<bool>& stop) {
+            for ( pipeline_backoff_t backoff; !try_push(std::forward<A>(a)); backoff() ) {
+                if ( stop.load(std::memory_order_relaxed) ) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool pop_wait(std::optional<T>& out, const std::atomic<bool>& stop) {
+            for ( pipeline_backoff_t backoff;; backoff() ) {
+                if ( try_pop(out) ) {
+                    return true;
+                }
+                if ( closed_.load(std::memory_order_acquire) ) {
+                    // the last items could be pushed right before closing
+                    return try_pop(out);
+                }
+                if ( stop.load(std::memory_order_relaxed) ) {
+                    return false;
+                }
+            }
+        }
+
+        void close() noexcept {
+            closed_.store(true, std::memory_order_release);
+        }
+    private:
+        struct slot_t {
+            alignas(T) std::byte data[sizeof(T)];
+        };
+
+        T* slot_(std::size_t index) noexcept {
+            return std::launder(reinterpret_cast<T*>(slots_[index & (Capacity - 1)].data));
+        }
+    private:
+        std::unique_ptr<slot_t[]> slots_{std::make_unique<slot_t[]>(Capacity)};
+        alignas(64) std::atomic<std::size_t> head_{0};
+        std::size_t tail_cache_{0};
+        alignas(64) std::atomic<std::size_t> tail_{0};
+        std::size_t head_cache_{0};
+        alignas(64) std::atomic<bool> closed_{false};
+    };
+
+    //
+    // pipeline_types
+    //
+    // The input type followed by the result types of every stage.
+    //
+
+    template < typename In, typename... Fs >
+    struct pipeline_types {
+        using type = std::tuple<In>;
+    };
+
+    template < typename In, typename F, typename... Fs >
+    struct pipeline_types<In, F, Fs...> {
+        using result_type = std::invoke_result_t<const F&, In&&>;
+
+        static_assert(
+            !std::is_void_v<result_type> && !is_curried_v<std::decay_t<result_type>>,
+            "pipeline stage should return a value for its input");
+
+        using type = decltype(std::tuple_cat(
+            std::declval<std::tuple<In>>(),
+            std::declval<typename pipeline_types<std::decay_t<result_type>, Fs...>::type>()));
+    };
+
+    template < typename Types, std::size_t Capacity >
+    struct pipeline_queues;
+
+    template < typename... Ts, std::size_t Capacity >
+    struct pipeline_queues<std::tuple<Ts...>, Capacity> {
+        using type = std::tuple<pipeline_queue_t<Ts, Capacity>...>;
+    };
+}
+
+namespace kari_hpp::ext
+{
+    //
+    // pipeline_stream_t
+    //
+    // Runs every stage on its own thread, the stages are connected by
+    // bounded lock-free queues. A full queue blocks its producer, so a
+    // slow stage throttles the input. Every queue is FIFO, the outputs
+    // come in the order of the inputs.
+    //
+    // push() and close() should be called from one thread, pop() from
+    // one (maybe the same) thread. After a stage throws, the stream drops
+    // the rest of the items and pop() rethrows the exception once the
+    // outputs produced before it are consumed.
+    //
+
+    inline constexpr std::size_t pipeline_stream_default_capacity = 256;
+
+    template < typename In, std::size_t Capacity, typename... Stages >
+    class pipeline_stream_t final {
+        static_assert(sizeof...(Stages) > 0, "pipeline should have at least one stage");
+
+        using types_t = typename detail::pipeline_types<In, Stages...>::type;
+        using queues_t = typename detail::pipeline_queues<types_t, Capacity>::type;
+        static constexpr std::size_t stage_count = sizeof...(Stages);
+    public:
+        using input_type = In;
+        using output_type = std::tuple_element_t<stage_count, types_t>;
+
+        explicit pipeline_stream_t(std::tuple<Stages...> stages)
+        : stages_(std::move(stages)) {
+            try {
+                start_(std::index_sequence_for<Stages...>());
+            } catch (...) {
+                stop_();
+                throw;
+            }
+        }
+
+        ~pipeline_stream_t() noexcept {
+            stop_();
+        }
+
+        pipeline_stream_t(pipeline_stream_t&&) = delete;
+        pipeline_stream_t& operator=(pipeline_stream_t&&) = delete;
+
+        pipeline_stream_t(const pipeline_stream_t&) = delete;
+        pipeline_stream_t& operator=(const pipeline_stream_t&) = delete;
+
+        template < typename A >
+        void push(A&& a) {
+            std::get<0>(queues_).push_wait(std::forward<A>(a), stop_flag_);
+        }
+
+        void close() noexcept {
+            std::get<0>(queues_).close();
+        }
+
+        std::optional<output_type> pop() {
+            std::optional<output_type> item;
+            if ( !std::get<stage_count>(queues_).pop_wait(item, stop_flag_) ) {
+                rethrow_();
+            }
+            return item;
+        }
+
+        //
+        // Feeds [first, last) to the stream and writes the outputs to `out`
+        // on the calling thread, then closes the stream.
+        //
+
+        template < typename Iter, typename Sentinel, typename OutIter >
+        OutIter run(Iter first, Sentinel last, OutIter out) {
+            auto& input = std::get<0>(queues_);
+            auto& output = std::get<stage_count>(queues_);
+
+            std::optional<output_type> item;
+            for ( detail::pipeline_backoff_t backoff; first != last; ) {
+                bool progress = false;
+                if ( input.try_push(*first) ) {
+                    ++first;
+                    progress = true;
+                }
+                if ( output.try_pop(item) ) {
+                    *out++ = std::move(*item);
+                    progress = true;
+                }
+                if ( progress ) {
+                    backoff.reset();
+                } else {
+                    backoff();
+                }
+            }
+
+            close();
+
+            while ( output.pop_wait(item, stop_flag_) ) {
+                *out++ = std::move(*item);
+            }
+
+            rethrow_();
+            return out;
+        }
+    private:
+        template < std::size_t... Is >
+        void start_(std::index_sequence<Is...>) {
+            ((threads_[Is] = std::thread([this](){ stage_<Is>(); })), ...);
+        }
+
+        template < std::size_t I >
+        void stage_() noexcept {
+            auto& input = std::get<I>(queues_);
+            auto& output = std::get<I + 1>(queues_);
+            const auto& stage = std::get<I>(stages_);
+
+            bool failed = false;
+            std::optional<std::tuple_element_t<I, types_t>> item;
+            while ( input.pop_wait(item, stop_flag_) ) {
+                if ( failed ) {
+                    // drains the input, so the upstream stages never block
+                    continue;
+                }
+                try {
+                    if ( !output.push_wait(stage(std::move(*item)), stop_flag_) ) {
+                        break;
+                    }
+                } catch (...) {
+                    errors_[I] = std::current_exception();
+                    failed = true;
+                    // wakes the downstream stages and pop() right away,
+                    // the input may stay open for a long time
+                    output.close();
+                }
+            }
+
+            output.close();
+        }
+
+        void rethrow_() const {
+            // a downstream stage fails on an earlier item than an upstream one
+            for ( std::size_t i = stage_count; i > 0; --i ) {
+                if ( errors_[i - 1] ) {
+                    std::rethrow_exception(errors_[i - 1]);
+                }
+            }
+        }
+
+        void stop_() noexcept {
+            stop_flag_.store(true, std::memory_order_relaxed);
+            close();
+            for ( std::thread& thread : threads_ ) {
+                if ( thread.joinable() ) {
+                    thread.join();
+                }
+            }
+        }
+    private:
+        std::tuple<Stages...> stages_;
+        queues_t queues_;
+        std::atomic<bool> stop_flag_{false};
+        std::array<std::exception_ptr, stage_count> errors_;
+        std::array<std::thread, stage_count> threads_;
+    };
+
+    //
+    // pipeline_stream
+    //
+    // `pipeline_stream<In>(a | b | c)` splits the composition and runs
+    // every stage on its own thread. With several arguments every argument
+    // is one stage, it groups cheap stages on one thread:
+    //
+    //   auto s = pipeline_stream<In>(a | b, c);
+    //
+
+    template < typename In, std::size_t Capacity, typename... Stages >
+    pipeline_stream_t<In, Capacity, Stages...> make_pipeline_stream(std::tuple<Stages...> stages) {
+        return pipeline_stream_t<In, Capacity, Stages...>(std::move(stages));
+    }
+
+    template < typename In
+             , std::size_t Capacity = pipeline_stream_default_capacity
+             , typename F, typename... Fs >
+    auto pipeline_stream(F&& f, Fs&&... fs) {
+        if constexpr ( sizeof...(Fs) == 0 ) {
+            return make_pipeline_stream<In, Capacity>(
+                detail::composition_stages<std::decay_t<F>>::split(f));
+        } else {
+            return make_pipeline_stream<In, Capacity>(
+                std::make_tuple(std::forward<F>(f), std::forward<Fs>(fs)...));
+        }
+    }
+}
@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/BlackMATov/kari.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2017-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "kari.hpp"
+
+#if __has_include(<version>)
+#   include <version>
+#endif
+
+#if defined(__cpp_lib_ranges)
+
+#include <concepts>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace kari_hpp::ext
+{
+    //
+    // range_closure
+    //
+    // A range adaptor closure: `range | closure` returns a lazy view.
+    // Closures compose with each other: `map(f) | filter(g)`.
+    //
+
+    template < typename Fn >
+    class range_closure final
+#if __cpp_lib_ranges >= 202202L
+    : public std::ranges::range_adaptor_closure<range_closure<Fn>>
+#endif
+    {
+    public:
+        constexpr explicit range_closure(Fn fn)
+        noexcept(std::is_nothrow_move_constructible_v<Fn>)
+        : fn_(std::move(fn)) {}
+
+        template < std::ranges::viewable_range R >
+            requires std::invocable<const Fn&, R>
+        constexpr auto operator()(R&& r) const {
+            return fn_(std::forward<R>(r));
+        }
+    private:
+        Fn fn_;
+    };
+
+    template < typename T >
+    struct is_range_closure
+    : std::false_type {};
+
+    template < typename Fn >
+    struct is_range_closure<range_closure<Fn>>
+    : std::true_type {};
+
+    template < typename T >
+    inline constexpr bool is_range_closure_v = is_range_closure<std::remove_cvref_t<T>>::value;
+
+#if __cpp_lib_ranges < 202202L
+    // std::ranges::range_adaptor_closure provides these since C++23
+
+    template < std::ranges::viewable_range R, typename Fn >
+        requires std::invocable<const range_closure<Fn>&, R>
+    constexpr auto operator|(R&& r, const range_closure<Fn>& c) {
+        return c(std::forward<R>(r));
+    }
+
+    template < typename A, typename B >
+    constexpr auto operator|(range_closure<A> a, range_closure<B> b) {
+        return range_closure([a = std::move(a), b = std::move(b)](auto&& r){
+            return b(a(std::forward<decltype(r)>(r)));
+        });
+    }
+#endif
+
+    //
+    // map
+    //
+
+    struct map_t {
+        template < typename F >
+        constexpr auto operator()(F&& f) const {
+            return range_closure([f = std::forward<F>(f)](auto&& r){
+                return std::views::transform(std::forward<decltype(r)>(r), f);
+            });
+        }
+    };
+    inline constexpr auto map = curry(map_t{});
+
+    //
+    // filter
+    //
+
+    struct filter_t {
+        template < typename F >
+        constexpr auto operator()(F&& f) const {
+            return range_closure([f = std::forward<F>(f)](auto&& r){
+                return std::views::filter(std::forward<decltype(r)>(r), f);
+            });
+        }
+    };
+    inline constexpr auto filter = curry(filter_t{});
+}
+
+#endif
@@ -0,0 +1,183 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/BlackMATov/kari.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2017-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "kari.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace kari_hpp::detail
+{
+    // a key next to the index of its record, so the comparisons of the
+    // sort read one contiguous array instead of the records
+    template < typename K, typename Index >
+    struct sort_entry final {
+        K key;
+        Index index;
+    };
+
+    // Moves records so that `first[i]` becomes the old `first[order[i]]`.
+    // Every cycle of the permutation is moved through one temporary,
+    // `order` is clobbered.
+    template < typename Iter, typename Index >
+    void gather_by_order(Iter first, std::vector<Index>& order) {
+        const std::size_t size = order.size();
+        for ( std::size_t start = 0; start < size; ++start ) {
+            if ( order[start] == start ) {
+                continue;
+            }
+
+            auto temp = std::move(first[static_cast<std::ptrdiff_t>(start)]);
+
+            std::size_t current = start;
+            for ( std::size_t source = order[current]; source != start; source = order[current] ) {
+                first[static_cast<std::ptrdiff_t>(current)] = std::move(first[static_cast<std::ptrdiff_t>(source)]);
+                order[current] = static_cast<Index>(current);
+                current = source;
+            }
+
+            first[static_cast<std::ptrdiff_t>(current)] = std::move(temp);
+            order[current] = static_cast<Index>(current);
+        }
+    }
+
+    template < typename Index, typename P, typename C, typename Iter >
+    void sort_by_range(const P& proj, const C& cmp, Iter first, std::size_t size) {
+        using key_t = std::decay_t<decltype(proj(*first))>;
+        using entry_t = sort_entry<key_t, Index>;
+
+        std::vector<entry_t> entries;
+        entries.reserve(size);
+        for ( std::size_t i = 0; i < size; ++i ) {
+            entries.push_back(entry_t{
+                proj(first[static_cast<std::ptrdiff_t>(i)]),
+                static_cast<Index>(i)});
+        }
+
+        std::sort(entries.begin(), entries.end(), [&cmp](const entry_t& l, const entry_t& r){
+            return static_cast<bool>(cmp(l.key, r.key));
+        });
+
+        std::vector<Index> order;
+        order.reserve(size);
+        for ( const entry_t& e : entries ) {
+            order.push_back(e.index);
+        }
+
+        // the keys are not needed anymore
+        entries = std::vector<entry_t>();
+        gather_by_order(first, order);
+    }
+
+    template < typename Index, typename P, typename C, typename Iter >
+    std::size_t partition_by_range(const P& proj, const C& pred, Iter first, std::size_t size) {
+        std::vector<unsigned char> flags(size);
+        std::size_t count = 0;
+        for ( std::size_t i = 0; i < size; ++i ) {
+            flags[i] = static_cast<bool>(pred(proj(first[static_cast<std::ptrdiff_t>(i)])));
+            count += flags[i];
+        }
+
+        std::vector<Index> order(size);
+        std::size_t head = 0;
+        std::size_t tail = count;
+        for ( std::size_t i = 0; i < size; ++i ) {
+            order[flags[i] ? head++ : tail++] = static_cast<Index>(i);
+        }
+
+        gather_by_order(first, order);
+        return count;
+    }
+
+    template < typename R >
+    auto random_access_bounds(R& range) {
+        using std::begin;
+        using std::end;
+        using iter_t = decltype(begin(range));
+
+        static_assert(
+            is_random_access_iterator_v<iter_t>,
+            "range should have random access iterators");
+
+        const iter_t first = begin(range);
+        const iter_t last = end(range);
+        return std::pair<iter_t, std::size_t>(first, static_cast<std::size_t>(last - first));
+    }
+}
+
+namespace kari_hpp::ext
+{
+    //
+    // fsort_by
+    //
+    // Sorts a random access range by the keys of its elements:
+    //
+    //   fsort_by(curry(&person::name) | to_lower, _ < _, std::ref(people));
+    //
+    // The projection is called exactly once per element, the keys go to
+    // a side array of {key, index} entries that is sorted instead of the
+    // range, and then every record is moved into its place once. The sort
+    // is not stable, like std::sort. Returns the end of the range.
+    //
+    // Bound arguments are stored by value, so ranges should be passed as
+    // std::ref, a copied range doesn't compile.
+    //
+
+    struct fsort_by_t {
+        template < typename P, typename C, typename R >
+        auto operator()(P&& proj, C&& cmp, R&& range) const {
+            static_assert(std::is_lvalue_reference_v<R>, "pass the range as std::ref");
+            const auto [first, size] = detail::random_access_bounds(range);
+
+            if ( size <= std::numeric_limits<std::uint32_t>::max() ) {
+                detail::sort_by_range<std::uint32_t>(proj, cmp, first, size);
+            } else {
+                detail::sort_by_range<std::size_t>(proj, cmp, first, size);
+            }
+
+            return first + static_cast<std::ptrdiff_t>(size);
+        }
+    };
+    inline constexpr auto fsort_by = curry(fsort_by_t{});
+
+    //
+    // fpartition_by
+    //
+    // Moves the elements whose keys satisfy `pred` before the others and
+    // returns the iterator to the first element of the second group:
+    //
+    //   fpartition_by(curry(&person::age), _ < 18, std::ref(people));
+    //
+    // The projection and the predicate are called exactly once per element.
+    // Unlike std::partition the relative order of elements is preserved.
+    //
+    // Bound arguments are stored by value, so ranges should be passed as
+    // std::ref, a copied range doesn't compile.
+    //
+
+    struct fpartition_by_t {
+        template < typename P, typename C, typename R >
+        auto operator()(P&& proj, C&& pred, R&& range) const {
+            static_assert(std::is_lvalue_reference_v<R>, "pass the range as std::ref");
+            const auto [first, size] = detail::random_access_bounds(range);
+
+            const std::size_t count = size <= std::numeric_limits<std::uint32_t>::max()
+                ? detail::partition_by_range<std::uint32_t>(proj, pred, first, size)
+                : detail::partition_by_range<std::size_t>(proj, pred, first, size);
+
+            return first + static_cast<std::ptrdiff_t>(count);
+        }
+    };
+    inline constexpr auto fpartition_by = curry(fpartition_by_t{});
+}
@@ -0,0 +1,247 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/BlackMATov/kari.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2017-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include "../kari_tests.hpp"
+
+#include <kari.hpp/kari_dyn_curry.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <optional>
+#include <tuple>
+#include <utility>
+
+//
+// Replaces the global allocation functions with counting ones, every test
+// checks that the counter doesn't change while kari.hpp does its work.
+// This executable is separate from the other tests, so that nothing else
+// depends on the replacement.
+//
+
+namespace
+{
+    std::atomic<std::size_t> allocations{0};
+
+    void* counted_malloc(std::size_t size) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        if ( void* p = std::malloc(size ? size : 1) ) {
+            return p;
+        }
+        throw std::bad_alloc();
+    }
+
+    void* counted_aligned_malloc(std::size_t size, std::align_val_t align) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        const std::size_t alignment = static_cast<std::size_t>(align);
+    #if defined(_MSC_VER)
+        void* p = _aligned_malloc(size ? size : 1, alignment);
+    #else
+        void* p = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+    #endif
+        if ( p ) {
+            return p;
+        }
+        throw std::bad_alloc();
+    }
+
+    void counted_aligned_free(void* p) noexcept {
+    #if defined(_MSC_VER)
+        _aligned_free(p);
+    #else
+        std::free(p);
+    #endif
+    }
+
+    template < typename F >
+    std::size_t count_allocations(F&& f) {
+        const std::size_t before = allocations.load(std::memory_order_relaxed);
+        static_cast<void>(f());
+        return allocations.load(std::memory_order_relaxed) - before;
+    }
+}
+
+void* operator new(std::size_t size) { return counted_malloc(size); }
+void* operator new[](std::size_t size) { return counted_malloc(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+void* operator new(std::size_t size, std::align_val_t align) { return counted_aligned_malloc(size, align); }
+void* operator new[](std::size_t size, std::align_val_t align) { return counted_aligned_malloc(size, align); }
+void operator delete(void* p, std::align_val_t) noexcept { counted_aligned_free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { counted_aligned_free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { counted_aligned_free(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { counted_aligned_free(p); }
+
+#define CHECK_NO_ALLOCATIONS(...)\
+    CHECK(count_allocations([&](){ return (__VA_ARGS__); }) == 0)
+
+using namespace kari_hpp;
+using namespace kari_hpp::ext;
+
+TEST_CASE("kari_alloc") {
+    // keeps the arguments opaque to the optimizer
+    volatile int volatile_one = 1;
+    volatile int volatile_two = 2;
+    const int one = volatile_one;
+    const int two = volatile_two;
+
+    SUBCASE("counter") {
+        CHECK(count_allocations([](){ return std::make_unique<int>(42); }) == 1);
+    }
+
+    SUBCASE("curry") {
+        const auto add3 = [](int a, int b, int c){ return a + b + c; };
+        const auto add3_c = curry(add3);
+        const auto add3_1 = curry(add3, one);
+        const auto add3_12 = add3_1(two);
+
+        CHECK_NO_ALLOCATIONS(curry(add3));
+        CHECK_NO_ALLOCATIONS(curry(add3, one));
+        CHECK_NO_ALLOCATIONS(curry(add3, one, two));
+        CHECK_NO_ALLOCATIONS(curry(add3, one, two, one));
+        CHECK_NO_ALLOCATIONS(curry(add3_c));
+
+        CHECK_NO_ALLOCATIONS(add3_c(one));
+        CHECK_NO_ALLOCATIONS(add3_c(one)(two)(one));
+        CHECK_NO_ALLOCATIONS(add3_c(one, two, one));
+        CHECK_NO_ALLOCATIONS(add3_1(two));
+        CHECK_NO_ALLOCATIONS(add3_12(one));
+        CHECK_NO_ALLOCATIONS(curry_t(add3_12)(one));
+        CHECK_NO_ALLOCATIONS(curry_t(add3_1)(two, one));
+    }
+
+    SUBCASE("curry members") {
+        struct box final {
+            int v;
+            int get() const { return v; }
+            int add(int a) const { return v + a; }
+        };
+
+        const box b{one};
+        CHECK_NO_ALLOCATIONS(curry(&box::v, b));
+        CHECK_NO_ALLOCATIONS(curry(&box::get, b));
+        CHECK_NO_ALLOCATIONS(curry(&box::add)(b)(two));
+        CHECK_NO_ALLOCATIONS(curry(&box::add, std::cref(b), two));
+    }
+
+    SUBCASE("ext") {
+        using namespace underscore;
+
+        CHECK_NO_ALLOCATIONS(fid(one));
+        CHECK_NO_ALLOCATIONS(fconst(one, two));
+        CHECK_NO_ALLOCATIONS(fconst(one)(two));
+        CHECK_NO_ALLOCATIONS(fflip(_ - _, one, two));
+        CHECK_NO_ALLOCATIONS(fflip(_ - _)(one)(two));
+        CHECK_NO_ALLOCATIONS(fpipe(_ + one, _ * two, one));
+        CHECK_NO_ALLOCATIONS(fpipe(_ + one, _ * two)(one));
+        CHECK_NO_ALLOCATIONS(fcompose(_ + one, _ * two, one));
+        CHECK_NO_ALLOCATIONS(fcompose(_ + one, _ * two)(one));
+        CHECK_NO_ALLOCATIONS(((_ + one) | (_ * two) | (_ - one))(two));
+        CHECK_NO_ALLOCATIONS(((_ + one) * (_ * two) * (_ - one))(two));
+        CHECK_NO_ALLOCATIONS(one | (_ + two));
+        CHECK_NO_ALLOCATIONS((_ + two) * one);
+        CHECK_NO_ALLOCATIONS(fstage(_ * two, _ + _)(one)(two));
+        CHECK_NO_ALLOCATIONS(fspread(_ - _, std::tuple(one, two)));
+        CHECK_NO_ALLOCATIONS((fconst(std::pair(one, two)) | fspread(_ - _))(two));
+    }
+
+    SUBCASE("ext bind") {
+        using namespace underscore;
+
+        const auto half = curry([](int v){
+            return v % 2 == 0 ? std::optional<int>(v / 2) : std::nullopt;
+        });
+
+        const std::optional<int> four(two * two);
+        CHECK_NO_ALLOCATIONS(fbind(half, four));
+        CHECK_NO_ALLOCATIONS(fkleisli(half, half)(two * two));
+        CHECK_NO_ALLOCATIONS(four |= half |= half);
+    }
+
+    SUBCASE("ext folds") {
+        using namespace underscore;
+
+        std::array<int, 256> values{};
+        values.fill(one);
+
+        CHECK_NO_ALLOCATIONS(ffold(_ + _, 0, std::cref(values)));
+        CHECK_NO_ALLOCATIONS(freduce(std::plus<>(), 0, std::cref(values)));
+        CHECK_NO_ALLOCATIONS(freduce(fassociative(_ + _), 0, std::cref(values)));
+        CHECK_NO_ALLOCATIONS(freduce(fcommutative(_ + _), 0, std::cref(values)));
+    }
+
+    SUBCASE("ext tables") {
+        using namespace underscore;
+
+        static constexpr auto f = ftabulate<std::uint8_t>((_ * 3) | (_ + 1));
+        CHECK_NO_ALLOCATIONS(f(static_cast<std::uint8_t>(one)));
+        CHECK_NO_ALLOCATIONS(ftabulate<domain<int, 0, 15>>(_ * two));
+    }
+
+    SUBCASE("underscore") {
+        using namespace underscore;
+
+        CHECK_NO_ALLOCATIONS((-_)(one));
+        CHECK_NO_ALLOCATIONS((~_)(one));
+        CHECK_NO_ALLOCATIONS((!_)(one));
+
+        #define KARI_HPP_CHECK_UNDERSCORE_BINARY_OP(op)\
+            CHECK_NO_ALLOCATIONS((_ op _)(one, two));\
+            CHECK_NO_ALLOCATIONS((_ op _)(one)(two));\
+            CHECK_NO_ALLOCATIONS((one op _)(two));\
+            CHECK_NO_ALLOCATIONS((_ op two)(one));
+
+            KARI_HPP_CHECK_UNDERSCORE_BINARY_OP(+ )
+            KARI_HPP_CHECK_UNDERSCORE_BINARY_OP(- )
+            KARI_HPP_CHECK_UNDERSCORE_BINARY_OP(* )
+            KARI_HPP_CHECK_UNDERSCORE_BINARY_OP(/ )
+            KARI_HPP_CHECK_UNDERSCORE_BINARY_OP(% )
+
+            KARI_HPP_CHECK_UNDERSCORE_BINARY_OP(< )
+            KARI_HPP_CHECK_UNDERSCORE_BINARY_OP(> )
+            KARI_HPP_CHECK_UNDERSCORE_BINARY_OP(<=)
+            KARI_HPP_CHECK_UNDERSCORE_BINARY_OP(>=)
+
+            KARI_HPP_CHECK_UNDERSCORE_BINARY_OP(==)
+            KARI_HPP_CHECK_UNDERSCORE_BINARY_OP(!=)
+
+            KARI_HPP_CHECK_UNDERSCORE_BINARY_OP(| )
+            KARI_HPP_CHECK_UNDERSCORE_BINARY_OP(& )
+            KARI_HPP_CHECK_UNDERSCORE_BINARY_OP(^ )
+
+            KARI_HPP_CHECK_UNDERSCORE_BINARY_OP(||)
+            KARI_HPP_CHECK_UNDERSCORE_BINARY_OP(&&)
+        #undef KARI_HPP_CHECK_UNDERSCORE_BINARY_OP
+
+        CHECK_NO_ALLOCATIONS(((_ > one) && (_ < two))(one));
+        CHECK_NO_ALLOCATIONS(((_ > one) || (_ < two))(one));
+    }
+
+    SUBCASE("dyn_curry") {
+        const auto add3 = [](int a, int b, int c){ return a + b + c; };
+
+        CHECK_NO_ALLOCATIONS(dyn_curry(add3));
+        CHECK_NO_ALLOCATIONS([&](){
+            dyn_curry c(add3);
+            const bool bound = c.bind(one) && c.bind(two) && c.bind(one);
+            return bound ? c.invoke<int>() : 0;
+        }());
+        CHECK_NO_ALLOCATIONS([&](){
+            dyn_curry c(add3);
+            static_cast<void>(c.bind(one));
+            dyn_curry d(c);
+            static_cast<void>(d.bind(two) && d.bind(one));
+            return d.invoke<int>();
+        }());
+    }
+}
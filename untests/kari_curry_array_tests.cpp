@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/BlackMATov/kari.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2017-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include "kari_tests.hpp"
+
+#include <kari.hpp/kari_curry_array.hpp>
+
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace kari_hpp;
+using namespace kari_hpp::ext;
+using namespace kari_hpp::ext::underscore;
+
+TEST_CASE("kari_curry_array") {
+    SUBCASE("members") {
+        curry_array<decltype(_ < 0)> rules;
+        CHECK(rules.empty());
+
+        rules.push_back(_ < 10);
+        rules.push_back(_ < 20);
+        rules.push_back(_ < 30);
+
+        REQUIRE(rules.size() == 3);
+        CHECK(rules.column<1>() == std::vector<int>{10, 20, 30});
+        CHECK(rules[1](15));
+        CHECK_FALSE(rules[1](25));
+
+        rules.clear();
+        CHECK(rules.empty());
+    }
+
+    SUBCASE("eval") {
+        curry_array<decltype(_ < 0)> rules;
+        rules.reserve(100);
+        for ( int i = 0; i < 100; ++i ) {
+            rules.push_back(_ < i);
+        }
+
+        std::vector<char> results(rules.size());
+        CHECK(rules.eval(results.data(), 42) == results.data() + results.size());
+
+        for ( int i = 0; i < 100; ++i ) {
+            CHECK(static_cast<bool>(results[static_cast<std::size_t>(i)]) == (42 < i));
+        }
+    }
+
+    SUBCASE("eval mask") {
+        curry_array<decltype(_ % 1)> rules;
+        for ( int i = 1; i <= 130; ++i ) {
+            rules.push_back(_ % i);
+        }
+
+        // bit i is set when (i + 1) doesn't divide 60
+        std::vector<std::uint64_t> mask((rules.size() + 63) / 64);
+        rules.eval_mask(mask.data(), 60);
+
+        for ( std::size_t i = 0; i < rules.size(); ++i ) {
+            const bool bit = (mask[i / 64] >> (i % 64)) & 1u;
+            CHECK(bit == (60 % static_cast<int>(i + 1) != 0));
+        }
+        CHECK((mask[2] >> 2) == 0);
+    }
+
+    SUBCASE("functions") {
+        const auto clamp = curry([](int lo, int hi, int v){
+            return v < lo ? lo : (v > hi ? hi : v);
+        });
+
+        curry_array<decltype(clamp(0, 0))> clamps;
+        clamps.push_back(clamp(0, 10));
+        clamps.emplace_back(5, 7);
+        clamps.emplace_back(-3, -1);
+
+        std::vector<int> results;
+        clamps.eval(std::back_inserter(results), 6);
+        CHECK(results == std::vector<int>{6, 6, -1});
+
+        std::vector<int> more;
+        clamps.eval(std::back_inserter(more), 100);
+        CHECK(more == std::vector<int>{10, 7, -1});
+    }
+
+    SUBCASE("function pointers") {
+        struct rules final {
+            static bool less(int l, int r) { return l < r; }
+            static bool greater(int l, int r) { return l > r; }
+        };
+
+        curry_array<decltype(curry(&rules::less)(0))> lesses;
+        CHECK_THROWS_AS(lesses.emplace_back(10), std::logic_error);
+
+        lesses.push_back(curry(&rules::less)(10));
+        lesses.push_back(curry(&rules::less)(20));
+        lesses.emplace_back(30);
+        CHECK_THROWS_AS(lesses.push_back(curry(&rules::greater)(40)), std::invalid_argument);
+        REQUIRE(lesses.size() == 3);
+
+        bool results[3]{};
+        lesses.eval(results, 15);
+        CHECK(results[0]);
+        CHECK_FALSE(results[1]);
+        CHECK_FALSE(results[2]);
+        CHECK(lesses[2](35));
+
+        curry_array<decltype(curry(&rules::less)(0))> greaters(&rules::greater);
+        greaters.emplace_back(10);
+        CHECK_THROWS_AS(greaters.push_back(curry(&rules::less)(20)), std::invalid_argument);
+        REQUIRE(greaters.size() == 1);
+        CHECK(greaters[0](5));
+    }
+
+    SUBCASE("stateful functions") {
+        struct in_range final {
+            int slack;
+            bool operator()(int lo, int hi, int v) const {
+                return lo - slack <= v && v <= hi + slack;
+            }
+            bool operator==(const in_range& other) const {
+                return slack == other.slack;
+            }
+        };
+
+        curry_array<decltype(curry(in_range{0}, 0, 0))> ranges;
+        ranges.push_back(curry(in_range{2}, 0, 10));
+        ranges.push_back(curry(in_range{2}, 20, 30));
+        ranges.emplace_back(40, 50);
+        CHECK_THROWS_AS(ranges.push_back(curry(in_range{3}, 0, 10)), std::invalid_argument);
+        REQUIRE(ranges.size() == 3);
+
+        std::vector<char> results(ranges.size());
+        ranges.eval(results.data(), 12);
+        CHECK(results == std::vector<char>{true, false, false});
+        ranges.eval(results.data(), 38);
+        CHECK(results == std::vector<char>{false, false, true});
+
+        int calls = 0;
+        const auto counted = curry([&calls](int lo, int v){
+            ++calls;
+            return lo < v;
+        });
+
+        curry_array<decltype(counted(0))> counters;
+        counters.push_back(counted(1));
+        counters.emplace_back(2);
+
+        std::uint64_t mask = 0;
+        counters.eval_mask(&mask, 2);
+        CHECK(mask == 1u);
+        CHECK(calls == 2);
+    }
+
+    SUBCASE("strings") {
+        const auto starts = curry([](const std::string& prefix, const std::string& s){
+            return s.compare(0, prefix.size(), prefix) == 0;
+        });
+
+        curry_array<decltype(starts(std::string()))> rules;
+        rules.push_back(starts(std::string("ab")));
+        rules.push_back(starts(std::string("b")));
+
+        bool results[2]{};
+        rules.eval(results, std::string("abc"));
+        CHECK(results[0]);
+        CHECK_FALSE(results[1]);
+    }
+}
@@ -0,0 +1,203 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/BlackMATov/kari.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2017-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include "kari_tests.hpp"
+
+#include <kari.hpp/kari_dataflow.hpp>
+
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace kari_hpp;
+using namespace kari_hpp::ext;
+using namespace kari_hpp::ext::underscore;
+
+TEST_CASE("kari_dataflow") {
+    using namespace dataflow;
+
+    SUBCASE("diamond") {
+        thread_pool pool{4};
+        graph g{pool};
+
+        auto& src = g.node<>([](){ return 20; });
+        auto& lhs = g.node<int>(_ + 1);
+        auto& rhs = g.node<int>(_ * 1);
+        auto& sum = g.node<int, int>(_ + _);
+
+        g.connect<0>(src, lhs);
+        g.connect<0>(src, rhs);
+        g.connect<0>(lhs, sum);
+        g.connect<1>(rhs, sum);
+
+        g.run();
+        g.wait();
+
+        REQUIRE(sum.ready());
+        REQUIRE(sum.get() == 41);
+    }
+
+    SUBCASE("external inputs") {
+        thread_pool pool{2};
+        graph g{pool};
+
+        auto& mul = g.node<int, int>(_ * _);
+        auto& sub = g.node<int, int>(_ - _);
+
+        g.connect<0>(mul, sub);
+
+        mul.set<0>(6);
+        sub.set<1>(7);
+        REQUIRE_FALSE(sub.ready());
+        mul.set<1>(8);
+        g.wait();
+
+        REQUIRE(sub.get() == 41);
+    }
+
+    SUBCASE("partially applied nodes") {
+        thread_pool pool{2};
+        graph g{pool};
+
+        auto& f = g.node<int>(curry([](int a, int b, int c){
+            return a * 100 + b * 10 + c;
+        }, 1, 2));
+
+        f.set<0>(3);
+        g.wait();
+
+        REQUIRE(f.get() == 123);
+    }
+
+    SUBCASE("wide fan-in") {
+        thread_pool pool{4};
+        graph g{pool};
+
+        auto& sum = g.node<int, int, int, int, int, int, int, int>(
+            [](int a, int b, int c, int d, int e, int f, int h, int i){
+                return a + b + c + d + e + f + h + i;
+            });
+
+        auto& n0 = g.node<>([](){ return 1; });
+        auto& n1 = g.node<>([](){ return 2; });
+        auto& n2 = g.node<>([](){ return 3; });
+        auto& n3 = g.node<>([](){ return 4; });
+        auto& n4 = g.node<>([](){ return 5; });
+        auto& n5 = g.node<>([](){ return 6; });
+        auto& n6 = g.node<>([](){ return 7; });
+        auto& n7 = g.node<>([](){ return 8; });
+
+        g.connect<0>(n0, sum);
+        g.connect<1>(n1, sum);
+        g.connect<2>(n2, sum);
+        g.connect<3>(n3, sum);
+        g.connect<4>(n4, sum);
+        g.connect<5>(n5, sum);
+        g.connect<6>(n6, sum);
+        g.connect<7>(n7, sum);
+
+        g.run();
+        g.wait();
+
+        REQUIRE(sum.get() == 36);
+    }
+
+    SUBCASE("exceptions") {
+        thread_pool pool{2};
+        graph g{pool};
+
+        auto& src = g.node<>([]() -> int { throw std::runtime_error("src"); });
+        auto& mid = g.node<int>(_ + 1);
+        auto& dst = g.node<int, int>(_ + _);
+        auto& other = g.node<>([](){ return 1; });
+        auto& lonely = g.node<int>(_ + 1);
+
+        g.connect<0>(src, mid);
+        g.connect<0>(mid, dst);
+        g.connect<1>(other, dst);
+
+        g.run();
+        g.wait();
+
+        // the failure reaches every downstream node
+        REQUIRE(src.ready());
+        REQUIRE(mid.ready());
+        REQUIRE(dst.ready());
+        REQUIRE_THROWS_AS(src.get(), std::runtime_error);
+        REQUIRE_THROWS_AS(mid.get(), std::runtime_error);
+        REQUIRE_THROWS_AS(dst.get(), std::runtime_error);
+        REQUIRE(other.get() == 1);
+
+        // a node with unfilled slots never runs
+        REQUIRE_FALSE(lonely.ready());
+        REQUIRE_THROWS_AS(lonely.get(), std::logic_error);
+    }
+
+    SUBCASE("exceptions of successors") {
+        // the first copy of the result throws
+        struct fragile final {
+            int v;
+            bool* thrown;
+
+            fragile(int nv, bool* nt)
+            : v(nv), thrown(nt) {}
+
+            fragile(fragile&&) = default;
+
+            fragile(const fragile& other)
+            : v(other.v), thrown(other.thrown) {
+                if ( !*thrown ) {
+                    *thrown = true;
+                    throw std::runtime_error("copy");
+                }
+            }
+        };
+
+        bool thrown = false;
+
+        thread_pool pool{2};
+        graph g{pool};
+
+        auto& src = g.node<>([&thrown](){ return fragile(1, &thrown); });
+        auto& first = g.node<fragile>([](const fragile& f){ return f.v + 1; });
+        auto& second = g.node<fragile>([](const fragile& f){ return f.v + 2; });
+
+        g.connect<0>(src, first);
+        g.connect<0>(src, second);
+
+        g.run();
+        g.wait();
+
+        // every successor is notified, the one that failed to take
+        // the value gets the error
+        REQUIRE(src.ready());
+        REQUIRE(first.ready());
+        REQUIRE(second.ready());
+        REQUIRE(src.get().v == 1);
+        REQUIRE_THROWS_AS(first.get(), std::runtime_error);
+        REQUIRE(second.get() == 3);
+    }
+
+    SUBCASE("parallel_reduce") {
+        thread_pool pool{4};
+
+        std::vector<long long> v(100000);
+        std::iota(v.begin(), v.end(), 1);
+
+        REQUIRE(parallel_reduce(pool, _ + _, 0LL, v) == 5000050000LL);
+        REQUIRE(parallel_reduce(pool, _ - _, 0LL, v) == -5000050000LL);
+        REQUIRE(parallel_reduce(pool, _ + _, 0LL, std::vector<long long>{}) == 0);
+
+        std::vector<std::string> s(20000);
+        for ( std::size_t i = 0; i < s.size(); ++i ) {
+            s[i] = std::to_string(i % 10);
+        }
+
+        REQUIRE(parallel_reduce(pool, _ + _, std::string(), s)
+            == ffold(_ + _, std::string(), std::cref(s)));
+    }
+}
@@ -0,0 +1,230 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/BlackMATov/kari.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2017-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include "kari_tests.hpp"
+
+#include <kari.hpp/kari_dyn_curry.hpp>
+
+#include <array>
+#include <memory>
+#include <string>
+
+using namespace kari_hpp;
+
+namespace
+{
+    int add3(int a, int b, int c) {
+        return a * 100 + b * 10 + c;
+    }
+}
+
+TEST_CASE("kari_dyn_curry") {
+    SUBCASE("bind and invoke") {
+        dyn_curry c = &add3;
+
+        REQUIRE(c.arity() == 3);
+        REQUIRE(c.bound() == 0);
+        REQUIRE_FALSE(c.saturated());
+        REQUIRE(c.returns<int>());
+        REQUIRE_FALSE(c.returns<float>());
+
+        REQUIRE(c.accepts<int>());
+        REQUIRE_FALSE(c.accepts<float>());
+
+        REQUIRE(c.bind(1));
+        REQUIRE(c.bind(2));
+        REQUIRE_FALSE(c.saturated());
+        REQUIRE_THROWS_AS(c.invoke<int>(), bad_dyn_curry_call);
+
+        REQUIRE(c.bind(3));
+        REQUIRE(c.saturated());
+        REQUIRE_FALSE(c.bind(4));
+
+        REQUIRE_THROWS_AS(c.invoke<float>(), bad_dyn_curry_call);
+        REQUIRE(c.invoke<int>() == 123);
+        REQUIRE(c.invoke<int>() == 123);
+    }
+
+    SUBCASE("type checking") {
+        dyn_curry c = [](int a, const std::string& b){
+            return b + std::to_string(a);
+        };
+
+        REQUIRE_FALSE(c.bind(1.f));
+        REQUIRE_FALSE(c.bind(std::string("hello")));
+        REQUIRE(c.bound() == 0);
+
+        REQUIRE(c.bind(42));
+        REQUIRE_FALSE(c.bind(42));
+        REQUIRE(c.bind(std::string("answer: ")));
+
+        REQUIRE(c.invoke<std::string>() == "answer: 42");
+    }
+
+    SUBCASE("explicit signature") {
+        dyn_curry c = dyn_curry::make<int, int, int>(curry([](auto a, auto b){
+            return a - b;
+        }));
+
+        REQUIRE(c.arity() == 2);
+        REQUIRE(c.bind(50));
+        REQUIRE(c.bind(8));
+        REQUIRE(c.invoke<int>() == 42);
+    }
+
+    SUBCASE("member functions") {
+        struct counter final {
+            int value;
+
+            int get() const { return value; }
+            int add(int v) { return value += v; }
+        };
+
+        dyn_curry get = &counter::get;
+        REQUIRE(get.arity() == 1);
+        REQUIRE(get.accepts<counter>());
+        REQUIRE(get.bind(counter{42}));
+        REQUIRE(get.invoke<int>() == 42);
+
+        // the object is bound by value, like the other arguments
+        dyn_curry add = &counter::add;
+        REQUIRE(add.arity() == 2);
+        REQUIRE_FALSE(add.bind(1));
+        REQUIRE(add.bind(counter{40}));
+        REQUIRE(add.bind(1));
+        REQUIRE(add.invoke<int>() == 41);
+        REQUIRE(add.invoke<int>() == 42);
+    }
+
+    SUBCASE("void result") {
+        int calls = 0;
+        dyn_curry c = [&calls](int v){
+            calls += v;
+        };
+
+        REQUIRE(c.returns<void>());
+        REQUIRE(c.bind(2));
+        c.invoke<void>();
+        c.invoke<void>();
+        REQUIRE(calls == 4);
+    }
+
+    SUBCASE("reference result") {
+        const std::string name = "kari";
+        dyn_curry c = [&name](int) -> const std::string& {
+            return name;
+        };
+
+        REQUIRE(c.returns<std::string>());
+        REQUIRE(c.bind(0));
+
+        // the result is a copy, not a reference to a temporary
+        const std::string r = c.invoke<std::string>();
+        REQUIRE(r == "kari");
+        REQUIRE(r.data() != name.data());
+    }
+
+    SUBCASE("copy and move") {
+        dyn_curry c0 = &add3;
+        REQUIRE(c0.bind(1));
+
+        dyn_curry c1 = c0;
+        REQUIRE(c1.bind(2));
+        REQUIRE(c1.bind(3));
+
+        dyn_curry c2 = c0;
+        REQUIRE(c2.bind(4));
+        REQUIRE(c2.bind(5));
+
+        REQUIRE(c0.bound() == 1);
+        REQUIRE(c1.invoke<int>() == 123);
+        REQUIRE(c2.invoke<int>() == 145);
+
+        dyn_curry c3 = std::move(c1);
+        REQUIRE(c3.invoke<int>() == 123);
+        REQUIRE(c1.arity() == 0);
+        REQUIRE_FALSE(c1.saturated());
+
+        c3 = c2;
+        REQUIRE(c3.invoke<int>() == 145);
+
+        c3 = std::move(c0);
+        REQUIRE(c3.bound() == 1);
+    }
+
+    SUBCASE("move-only functions and arguments") {
+        {
+            dyn_curry c = [p = std::make_unique<int>(40)](int v){
+                return *p + v;
+            };
+
+            REQUIRE_FALSE(c.copyable());
+            REQUIRE(c.bind(2));
+            REQUIRE(c.invoke<int>() == 42);
+            REQUIRE_THROWS_AS(dyn_curry(c), bad_dyn_curry_copy);
+
+            dyn_curry c1 = std::move(c);
+            REQUIRE(c1.invoke<int>() == 42);
+        }
+        {
+            dyn_curry c = [](std::unique_ptr<int> p, int v){
+                return *p + v;
+            };
+
+            REQUIRE_FALSE(c.copyable());
+            REQUIRE(c.bind(std::make_unique<int>(40)));
+            REQUIRE(c.bind(2));
+            REQUIRE(c.invoke<int>() == 42);
+        }
+        {
+            dyn_curry c = &add3;
+            REQUIRE(c.copyable());
+        }
+    }
+
+    SUBCASE("rvalue reference parameters") {
+        // the function gets the stored argument as an rvalue, moving from
+        // it leaves the stored argument moved-from for the next call
+        dyn_curry c = [](std::string&& s){
+            std::string r = std::move(s);
+            return r.size();
+        };
+
+        REQUIRE(c.accepts<std::string>());
+        REQUIRE(c.bind(std::string(32, 'k')));
+        REQUIRE(c.invoke<std::size_t>() == 32);
+        REQUIRE(c.invoke<std::size_t>() == 0);
+    }
+
+    SUBCASE("non-trivial and oversized arguments") {
+        const auto sum = [](const std::array<int, 64>& a, std::shared_ptr<int> b){
+            int r = *b;
+            for ( int v : a ) {
+                r += v;
+            }
+            return r;
+        };
+
+        dyn_curry c = sum;
+
+        std::array<int, 64> a{};
+        a.fill(1);
+
+        const auto b = std::make_shared<int>(10);
+        REQUIRE(c.bind(a));
+        REQUIRE(c.bind(b));
+        REQUIRE(b.use_count() == 2);
+
+        dyn_curry c1 = c;
+        REQUIRE(b.use_count() == 3);
+
+        dyn_curry c2 = std::move(c);
+        REQUIRE(b.use_count() == 3);
+
+        REQUIRE(c1.invoke<int>() == 74);
+        REQUIRE(c2.invoke<int>() == 74);
+    }
+}
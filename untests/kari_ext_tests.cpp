@@ -6,9 +6,78 @@
 
 #include "kari_tests.hpp"
 
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
 using namespace kari_hpp;
 using namespace kari_hpp::ext;
 
+namespace
+{
+    struct test_error final {
+        int code;
+    };
+
+    struct test_unexpected final {
+        test_error e;
+    };
+
+    template < typename T >
+    struct test_expected final {
+        using value_type = T;
+        using error_type = test_error;
+        using unexpected_type = test_unexpected;
+
+        template < typename U >
+        using rebind = test_expected<U>;
+
+        std::optional<T> v;
+        test_error e{};
+
+        constexpr test_expected(T nv) : v(nv) {}
+        constexpr test_expected(test_unexpected ne) : e(ne.e) {}
+
+        constexpr bool has_value() const { return v.has_value(); }
+        constexpr const T& operator*() const { return *v; }
+        constexpr const test_error& error() const { return e; }
+    };
+
+    struct copy_counted_range final {
+        std::vector<int> v;
+        int* copies;
+
+        copy_counted_range(std::vector<int> nv, int* nc)
+        : v(std::move(nv)), copies(nc) {}
+
+        copy_counted_range(copy_counted_range&&) = default;
+
+        copy_counted_range(const copy_counted_range& other)
+        : v(other.v), copies(other.copies) { ++*copies; }
+
+        auto begin() const noexcept { return v.begin(); }
+        auto end() const noexcept { return v.end(); }
+    };
+
+    template < typename D, typename = void >
+    struct has_domain_of : std::false_type {};
+
+    template < typename D >
+    struct has_domain_of<D, std::void_t<domain_of_t<D>>> : std::true_type {};
+
+    template < typename D >
+    inline constexpr bool has_domain_of_v = has_domain_of<D>::value;
+}
+
 TEST_CASE("kari_ext") {
     struct box final {
         int v;
@@ -67,6 +136,359 @@ TEST_CASE("kari_ext") {
         }
     }
 
+    SUBCASE("fstage") {
+        using namespace underscore;
+        {
+            constexpr auto s = fstage(_*2, _+_);
+            STATIC_CHECK(s(3, 4) == 10);
+            STATIC_CHECK(s(3)(4) == 10);
+        }
+        {
+            struct prepared final {
+                std::string pattern;
+                int* copies;
+
+                prepared(std::string np, int* nc)
+                : pattern(std::move(np)), copies(nc) {}
+
+                prepared(prepared&& other) = default;
+
+                prepared(const prepared& other)
+                : pattern(other.pattern), copies(other.copies) { ++*copies; }
+            };
+
+            int prepares = 0;
+            int copies = 0;
+
+            const auto match = fstage(
+                [&prepares, &copies](const std::string& p){
+                    ++prepares;
+                    return prepared(p + p, &copies);
+                },
+                [](const prepared& p, const std::string& input){
+                    return p.pattern == input;
+                });
+
+            const auto m = match("ab");
+            REQUIRE(prepares == 1);
+
+            CHECK(m("abab"));
+            CHECK_FALSE(m("ab"));
+            CHECK(m("abab"));
+            CHECK(prepares == 1);
+            CHECK(copies == 0);
+
+            CHECK(match("cd", "cdcd"));
+            CHECK(prepares == 2);
+        }
+        {
+            // a throwing preparation reaches the caller
+            const auto s = fstage(
+                [](int v){
+                    if ( v < 0 ) {
+                        throw std::invalid_argument("negative");
+                    }
+                    return v;
+                },
+                _+_);
+            CHECK(s(1, 2) == 3);
+            CHECK_THROWS_AS(s(-1), std::invalid_argument);
+        }
+        {
+            // stages chain, the next stage gets the prepared value first
+            int prepares = 0;
+            const auto s = fstage(
+                [&prepares](int a){ ++prepares; return a * 10; },
+                fstage(
+                    [&prepares](int a, int b){ ++prepares; return a + b; },
+                    [](int ab, int c){ return ab * c; }));
+
+            const auto s1 = s(1);
+            const auto s2 = s1(2);
+            CHECK(prepares == 2);
+            CHECK(s2(3) == 36);
+            CHECK(s2(4) == 48);
+            CHECK(s1(3, 2) == 26);
+            CHECK(prepares == 3);
+        }
+    }
+
+    SUBCASE("fspread") {
+        using namespace underscore;
+        constexpr auto s3 = [](int v1, int v2, int v3){
+            return v1 * 100 + v2 * 10 + v3;
+        };
+        STATIC_CHECK(fspread(_-_, std::pair(5, 3)) == 2);
+        STATIC_CHECK(fspread(s3, std::tuple(1, 2, 3)) == 123);
+        STATIC_CHECK(fspread(s3, std::array<int, 3>{1, 2, 3}) == 123);
+        STATIC_CHECK(fspread(_-_, std::tuple<>())(5, 3) == 2);
+        {
+            // partial application, before and after the spread elements
+            STATIC_CHECK(fspread(s3, std::pair(1, 2))(3) == 123);
+            STATIC_CHECK(fspread(curry(s3, 1), std::pair(2, 3)) == 123);
+            STATIC_CHECK(fspread(s3)(std::pair(1, 2), 3) == 123);
+        }
+        {
+            constexpr auto split = curry([](int v){
+                return std::pair(v / 10, v % 10);
+            });
+            STATIC_CHECK((split | fspread(_-_))(42) == 2);
+            STATIC_CHECK((42 | split | fspread(_*_)) == 8);
+            STATIC_CHECK((split | fspread(s3))(12, 3) == 123);
+            STATIC_CHECK((fspread(s3) * split)(12)(3) == 123);
+        }
+        {
+            // the elements of rvalues are moved, not copied
+            struct counted final {
+                int v;
+                int* copies;
+
+                counted(int nv, int* nc) : v(nv), copies(nc) {}
+                counted(counted&& other) = default;
+                counted(const counted& other) : v(other.v), copies(other.copies) { ++*copies; }
+            };
+
+            int copies = 0;
+            const auto make = curry([&copies](int v){
+                return std::tuple(counted(v, &copies), std::make_unique<int>(v * 2));
+            });
+            const auto sum = curry([](counted c, std::unique_ptr<int> p, int v){
+                return c.v + *p + v;
+            });
+
+            const auto p = make | fspread(sum);
+            CHECK(p(10, 1) == 31);
+            CHECK(p(10)(2) == 32);
+            CHECK(copies == 0);
+
+            auto t = make(1);
+            CHECK(fspread(sum, std::move(t), 0) == 3);
+            CHECK(copies == 0);
+        }
+    }
+
+    SUBCASE("fbind") {
+        using namespace underscore;
+
+        constexpr auto half = [](int v) -> std::optional<int> {
+            return v % 2 == 0 ? std::optional<int>(v / 2) : std::nullopt;
+        };
+
+        STATIC_CHECK(fbind(_+2, std::optional<int>(4)) == 6);
+        STATIC_CHECK(fbind(_+2, std::optional<int>()) == std::nullopt);
+        STATIC_CHECK(fbind(half, std::optional<int>(4)) == 2);
+        STATIC_CHECK(fbind(half, std::optional<int>(5)) == std::nullopt);
+
+        STATIC_CHECK((std::optional<int>(4) |= _+2) == 6);
+        STATIC_CHECK((std::optional<int>(4) |= curry(half) |= _+2) == 4);
+        STATIC_CHECK((std::optional<int>(5) |= curry(half) |= _+2) == std::nullopt);
+        STATIC_CHECK((std::optional<int>(8) |= curry(half) |= curry(half) |= _*10) == 20);
+        STATIC_CHECK((std::optional<int>(6) |= curry(half) |= curry(half) |= _*10) == std::nullopt);
+        {
+            int calls = 0;
+            const auto count = [&calls](int v){
+                ++calls;
+                return v;
+            };
+
+            REQUIRE((std::optional<int>(5) |= curry(half) |= curry(count) |= _+1) == std::nullopt);
+            REQUIRE(calls == 0);
+
+            REQUIRE((std::optional<int>(4) |= curry(half) |= curry(count) |= _+1) == 3);
+            REQUIRE(calls == 1);
+        }
+        {
+            // `m |= f` returns the result and leaves `m` unchanged
+            std::optional<int> m(4);
+            const std::optional<int> r = m |= _+2;
+            REQUIRE(r == 6);
+            REQUIRE(m == 4);
+        }
+    }
+
+    SUBCASE("fbind expected") {
+        using namespace underscore;
+
+        using expected = test_expected<int>;
+
+        constexpr auto parse = [](int v) -> expected {
+            return v >= 0 ? expected(v) : expected(test_unexpected{{v}});
+        };
+
+        STATIC_CHECK(*(expected(4) |= curry(parse) |= _*2) == 8);
+        STATIC_CHECK((expected(-4) |= curry(parse) |= _*2).error().code == -4);
+        STATIC_CHECK((expected(test_unexpected{{42}}) |= curry(parse) |= _*2).error().code == 42);
+    }
+
+    SUBCASE("ffold") {
+        using namespace underscore;
+
+        constexpr std::array<int, 4> a{1, 2, 3, 4};
+
+        STATIC_CHECK(ffold(_ + _, 0, a) == 10);
+        STATIC_CHECK(ffold(_ - _, 0, a) == -10);
+        STATIC_CHECK(ffold([](int acc, int v){ return acc * 10 + v; })(0, a) == 1234);
+        STATIC_CHECK(ffold(_ + _, 42, std::array<int, 0>{}) == 42);
+
+        const auto sum = ffold(_ + _, 0);
+        CHECK(sum(std::cref(a)) == 10);
+    }
+
+    SUBCASE("freduce") {
+        using namespace underscore;
+
+        STATIC_CHECK(is_associative_v<decltype(_ + _)>);
+        STATIC_CHECK(is_associative_v<decltype(_ * _)>);
+        STATIC_CHECK(is_associative_v<decltype(_ | _)>);
+        STATIC_CHECK(is_associative_v<decltype(_ & _)>);
+        STATIC_CHECK(is_associative_v<decltype(_ ^ _)>);
+        STATIC_CHECK(is_commutative_v<decltype(_ + _)>);
+        STATIC_CHECK_FALSE(is_associative_v<decltype(_ - _)>);
+        STATIC_CHECK_FALSE(is_associative_v<decltype(_ + 1)>);
+        STATIC_CHECK_FALSE(is_commutative_v<decltype(_ / _)>);
+
+        STATIC_CHECK(is_associative_v<decltype(fassociative(_ - _))>);
+        STATIC_CHECK_FALSE(is_commutative_v<decltype(fassociative(_ - _))>);
+        STATIC_CHECK(is_commutative_v<decltype(fcommutative(_ - _))>);
+        STATIC_CHECK(is_associative_v<decltype(fcommutative(fassociative(_ - _)))>);
+        STATIC_CHECK(is_commutative_v<decltype(fcommutative(fassociative(_ - _)))>);
+
+        constexpr std::array<int, 4> a{1, 2, 3, 4};
+
+        STATIC_CHECK(freduce(_ + _, 0, a) == 10);
+        STATIC_CHECK(freduce(_ * _, 1, a) == 24);
+        STATIC_CHECK(freduce(_ - _, 0, a) == -10);
+        STATIC_CHECK(freduce(_ + _, 42, std::array<int, 0>{}) == 42);
+        {
+            std::vector<int> v(1000);
+            std::iota(v.begin(), v.end(), 1);
+
+            REQUIRE(freduce(_ + _, 0, std::cref(v)) == 500500);
+            REQUIRE(freduce(_ ^ _, 0, std::cref(v)) == ffold(_ ^ _, 0, std::cref(v)));
+            REQUIRE(freduce(fassociative(_ + _), 0, std::cref(v)) == 500500);
+            REQUIRE(freduce(fcommutative(fassociative(_ + _)), 0, std::cref(v)) == 500500);
+        }
+        {
+            std::vector<std::string> v;
+            for ( int i = 0; i < 200; ++i ) {
+                v.push_back(std::to_string(i % 10));
+            }
+
+            REQUIRE(freduce(_ + _, std::string(">"), std::cref(v))
+                == ffold(_ + _, std::string(">"), std::cref(v)));
+        }
+        {
+            std::list<int> l{1, 2, 3, 4};
+            REQUIRE(freduce(_ + _, 0, std::cref(l)) == 10);
+        }
+        {
+            // lvalue ranges are taken by reference, rvalue ranges are moved
+            int copies = 0;
+            const copy_counted_range r{{1, 2, 3, 4}, &copies};
+
+            REQUIRE(ffold(_ + _, 0, r) == 10);
+            REQUIRE(freduce(_ + _, 0, r) == 10);
+            REQUIRE(ffold(_ + _)(0)(r) == 10);
+            REQUIRE(freduce(_ + _, 0)(r) == 10);
+            REQUIRE(freduce(_ + _, 0, copy_counted_range{{1, 2}, &copies}) == 3);
+            REQUIRE(copies == 0);
+
+            const auto sum = freduce(_ + _, 0);
+            REQUIRE(sum(r) == 10);
+            REQUIRE(sum(r) == 10);
+            REQUIRE(copies == 0);
+        }
+    }
+
+    SUBCASE("ftabulate") {
+        using namespace underscore;
+        {
+            constexpr auto f = ftabulate<std::uint8_t>((_ * 3) | (_ + 1));
+
+            STATIC_CHECK(f.table().size() == 256);
+            STATIC_CHECK(f(0) == 1);
+            STATIC_CHECK(f(10) == 31);
+            STATIC_CHECK(f(255) == 766);
+        }
+        {
+            constexpr auto f = ftabulate<std::int8_t>(-_);
+
+            STATIC_CHECK(f(-128) == 128);
+            STATIC_CHECK(f(0) == 0);
+            STATIC_CHECK(f(127) == -127);
+        }
+        {
+            constexpr auto f = ftabulate<domain<int, 0, 4095>>([](int code){
+                return (code >> 8) + (code & 0xFF);
+            });
+
+            STATIC_CHECK(f.table().size() == 4096);
+            STATIC_CHECK(f(0x0102) == 3);
+            STATIC_CHECK(f(0x0FFF) == 270);
+        }
+        {
+            enum class color { red = 1, green, blue };
+
+            constexpr auto f = ftabulate<domain<color, color::red, color::blue>>([](color c){
+                return c == color::green;
+            });
+
+            STATIC_CHECK(f.table().size() == 3);
+            STATIC_CHECK_FALSE(f(color::red));
+            STATIC_CHECK(f(color::green));
+            STATIC_CHECK_FALSE(f(color::blue));
+        }
+        {
+            static constexpr auto f = ftabulate<domain<int, 0, 4095>>((_ * 2) | (_ + 1));
+
+            STATIC_CHECK(f(4095) == 8191);
+            REQUIRE((2048 | curry(std::cref(f))) == 4097);
+        }
+        {
+            STATIC_CHECK(has_domain_of_v<std::uint8_t>);
+            STATIC_CHECK(has_domain_of_v<std::int8_t>);
+            STATIC_CHECK(has_domain_of_v<domain<int, -1, 1>>);
+            STATIC_CHECK_FALSE(has_domain_of_v<std::uint16_t>);
+            STATIC_CHECK_FALSE(has_domain_of_v<std::int16_t>);
+            STATIC_CHECK_FALSE(has_domain_of_v<int>);
+        }
+        {
+            using u8_d = domain_of_t<std::uint8_t>;
+            STATIC_CHECK(detail::domain_contains<u8_d>(0));
+            STATIC_CHECK(detail::domain_contains<u8_d>(255u));
+            STATIC_CHECK_FALSE(detail::domain_contains<u8_d>(256));
+            STATIC_CHECK_FALSE(detail::domain_contains<u8_d>(300));
+            STATIC_CHECK_FALSE(detail::domain_contains<u8_d>(-1));
+            STATIC_CHECK_FALSE(detail::domain_contains<u8_d>(~0ull));
+
+            using i8_d = domain_of_t<std::int8_t>;
+            STATIC_CHECK(detail::domain_contains<i8_d>(-128));
+            STATIC_CHECK(detail::domain_contains<i8_d>(127u));
+            STATIC_CHECK_FALSE(detail::domain_contains<i8_d>(128u));
+            STATIC_CHECK_FALSE(detail::domain_contains<i8_d>(-129));
+
+            using pos_d = domain<int, 10, 20>;
+            STATIC_CHECK_FALSE(detail::domain_contains<pos_d>(9u));
+            STATIC_CHECK(detail::domain_contains<pos_d>(10u));
+            STATIC_CHECK(detail::domain_contains<pos_d>(20u));
+            STATIC_CHECK_FALSE(detail::domain_contains<pos_d>(21u));
+        }
+        {
+            enum class color { red, green };
+            constexpr auto f = ftabulate<std::uint8_t>(_ + 1);
+            constexpr auto g = ftabulate<domain<color, color::red, color::green>>([](color c){
+                return c == color::green;
+            });
+
+            STATIC_CHECK(std::is_invocable_v<decltype(f), int>);
+            STATIC_CHECK(std::is_invocable_v<decltype(f), std::uint64_t>);
+            STATIC_CHECK_FALSE(std::is_invocable_v<decltype(f), double>);
+            STATIC_CHECK_FALSE(std::is_invocable_v<decltype(f), bool>);
+            STATIC_CHECK(std::is_invocable_v<decltype(g), color>);
+            STATIC_CHECK_FALSE(std::is_invocable_v<decltype(g), int>);
+        }
+    }
+
     SUBCASE("underscore") {
         using namespace underscore;
         STATIC_CHECK((-_)(40) == -40);
@@ -104,4 +526,171 @@ TEST_CASE("kari_ext") {
         STATIC_CHECK_FALSE((_ == _)(42,40));
         STATIC_CHECK_FALSE((_ != _)(42,42));
     }
+
+    SUBCASE("underscore predicates") {
+        using namespace underscore;
+        {
+            constexpr auto in = (_ > 0) && (_ < 10);
+            constexpr auto out = (_ <= 0) || (_ >= 10);
+            STATIC_CHECK(in(5));
+            STATIC_CHECK_FALSE(in(0));
+            STATIC_CHECK_FALSE(in(10));
+            STATIC_CHECK_FALSE(out(5));
+            STATIC_CHECK(out(0));
+            STATIC_CHECK(out(10));
+            STATIC_CHECK((in && (_ != 5))(4));
+            STATIC_CHECK_FALSE((in && (_ != 5))(5));
+            STATIC_CHECK(((_ < _) || (_ == _))(4, 4));
+            STATIC_CHECK_FALSE(((_ < _) && (_ == _))(4, 4));
+            STATIC_CHECK(noexcept(in(5)));
+        }
+        {
+            int calls = 0;
+            const auto expensive = curry([&calls](int v){
+                ++calls;
+                return v % 2 == 0;
+            });
+
+            const auto all = (_ > 0) && expensive;
+            const auto any = (_ > 0) || expensive;
+
+            CHECK_FALSE(all(-2));
+            CHECK(calls == 0);
+            CHECK(all(2));
+            CHECK(calls == 1);
+
+            CHECK(any(3));
+            CHECK(calls == 1);
+            CHECK(any(-2));
+            CHECK(calls == 2);
+        }
+    }
+
+    SUBCASE("noexcept") {
+        using namespace underscore;
+
+        STATIC_CHECK(noexcept(fid(10)));
+        STATIC_CHECK(noexcept(fconst(10, 20)));
+        STATIC_CHECK(noexcept(fflip(_ - _, 10, 20)));
+        STATIC_CHECK(noexcept(fpipe(_+2, _*2, 4)));
+        STATIC_CHECK(noexcept(fcompose(_+2, _*2, 4)));
+        STATIC_CHECK(noexcept(fbind(_+1, std::optional<int>(1))));
+        STATIC_CHECK(noexcept(fkleisli(_+1, _*2, 4)));
+        STATIC_CHECK(noexcept(fkleisli(fbind(_+1), _*2, std::optional<int>(4))));
+        {
+            const auto half = [](int v) -> std::optional<int> {
+                if ( v < 0 ) { throw v; }
+                return v / 2;
+            };
+            STATIC_CHECK_FALSE(noexcept(fbind(half, std::optional<int>(1))));
+            STATIC_CHECK_FALSE(noexcept(fkleisli(half, _*2, 4)));
+            STATIC_CHECK_FALSE(noexcept(std::optional<int>(1) |= curry(half)));
+        }
+        {
+            constexpr std::array<int, 4> a{1, 2, 3, 4};
+            STATIC_CHECK(noexcept(ffold(_+_, 0, a)));
+            STATIC_CHECK(noexcept(freduce(_+_, 0, a)));
+            STATIC_CHECK(noexcept(ffold(_+_, 0)(std::cref(a))));
+            STATIC_CHECK(noexcept(freduce(_+_, 0)(std::cref(a))));
+
+            const auto add = [](int l, int r){ return l + r; };
+            STATIC_CHECK_FALSE(noexcept(ffold(add, 0, a)));
+            STATIC_CHECK_FALSE(noexcept(freduce(add, 0, a)));
+            STATIC_CHECK_FALSE(noexcept(ffold(_+_, std::string(), std::array<std::string, 2>{})));
+        }
+        {
+            STATIC_CHECK(noexcept(fstage(_*2, _+_, 3)));
+            STATIC_CHECK(noexcept(fstage(_*2, _+_, 3, 4)));
+            STATIC_CHECK(noexcept(fstage(_*2, _+_)(3)));
+
+            const auto prepare = [](int v){
+                if ( v < 0 ) { throw v; }
+                return v * 2;
+            };
+            STATIC_CHECK_FALSE(noexcept(fstage(prepare, _+_, 3)));
+            STATIC_CHECK_FALSE(noexcept(fstage(prepare, _+_)(3)));
+        }
+        {
+            STATIC_CHECK(noexcept(fspread(_+_, std::pair(1, 2))));
+            STATIC_CHECK(noexcept(fspread(_+_, std::tuple(1))));
+            STATIC_CHECK(noexcept(fspread(_+_, std::tuple<>())));
+            STATIC_CHECK_FALSE(noexcept(fspread(_+_, std::pair(std::string(), std::string()))));
+        }
+
+        {
+            STATIC_CHECK(noexcept((_ + 2) | (_ * 2)));
+            STATIC_CHECK(noexcept((_ + 2) * (_ * 2)));
+            STATIC_CHECK(noexcept(2 | (_ + 2)));
+            STATIC_CHECK(noexcept((_ + 2) * 2));
+            STATIC_CHECK(noexcept(((_ + 2) | (_ * 2))(4)));
+            STATIC_CHECK(noexcept(std::optional<int>(4) |= (_ + 2)));
+            STATIC_CHECK(noexcept((_ + 1) |= (_ * 2)));
+
+            const auto twice = curry([](std::string s){ return s + s; });
+            STATIC_CHECK_FALSE(noexcept(std::string() | twice));
+            STATIC_CHECK_FALSE(noexcept(twice * std::string()));
+        }
+        {
+            STATIC_CHECK(noexcept(fassociative(_ + _)));
+            STATIC_CHECK(noexcept(fcommutative(_ + _)));
+            STATIC_CHECK(noexcept(fassociative(_ + _)(1, 2)));
+            STATIC_CHECK(noexcept(fcommutative(_ + _)(1, 2)));
+
+            const auto add = [](int l, int r){ return l + r; };
+            STATIC_CHECK_FALSE(noexcept(fassociative(add)(1, 2)));
+            STATIC_CHECK_FALSE(noexcept(fcommutative(add)(1, 2)));
+        }
+        {
+            STATIC_CHECK(noexcept((_ < 10) && (_ > 0)));
+            STATIC_CHECK(noexcept((_ < 10) || (_ > 0)));
+            STATIC_CHECK(noexcept(((_ < 10) && (_ > 0))(5)));
+            STATIC_CHECK(noexcept(((_ < 10) || (_ > 0))(5)));
+        }
+        {
+            constexpr auto f = ftabulate<std::uint8_t>(_ + 1);
+            STATIC_CHECK(noexcept(f(1)));
+            STATIC_CHECK(noexcept(curry(f)(1)));
+        }
+
+        STATIC_CHECK(noexcept(-_));
+        STATIC_CHECK(noexcept(_ + _));
+        STATIC_CHECK(noexcept(_ + 2));
+        STATIC_CHECK(noexcept(2 + _));
+        STATIC_CHECK(noexcept((_ + _)(40, 2)));
+        STATIC_CHECK(noexcept((_ + 2)(40)));
+        STATIC_CHECK(noexcept((2 + _)(40)));
+        STATIC_CHECK(noexcept((_ < _)(40, 2)));
+        STATIC_CHECK(noexcept((_ && _)(true, false)));
+    }
+
+    SUBCASE("trivially copyable") {
+        using namespace underscore;
+
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype(fid)>);
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype(fconst(10))>);
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype(fflip(_ - _))>);
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype(fpipe(_+2, _*2))>);
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype(fcompose(_+2, _*2))>);
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype(fbind(_+1))>);
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype(fkleisli(_+1, _*2))>);
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype((_+1) |= (_*2))>);
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype(ffold(_+_, 0))>);
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype(freduce(_+_, 0))>);
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype(fspread(_+_))>);
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype((_*2) | fspread(_+_))>);
+
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype(-_)>);
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype(_ + _)>);
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype(_ + 2)>);
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype(2 + _)>);
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype((_ + 2) | (_ * 2))>);
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype((_ + 2) * (_ * 2))>);
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype(fstage(_ * 2, _ + _))>);
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype(fstage(_ * 2, _ + _, 1))>);
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype(fassociative(_ + _))>);
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype(fcommutative(_ + _))>);
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype((_ < 10) && (_ > 0))>);
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype((_ < 10) || (_ > 0))>);
+        STATIC_CHECK(std::is_trivially_copyable_v<decltype(ftabulate<std::uint8_t>(_ + 1))>);
+    }
 }
@@ -0,0 +1,253 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/BlackMATov/kari.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2017-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include "kari_tests.hpp"
+
+#include <kari.hpp/kari_incremental.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace kari_hpp;
+using namespace kari_hpp::ext;
+using namespace kari_hpp::ext::underscore;
+
+namespace
+{
+    // a cell that counts how many times it is pulled
+    struct counted_cell final {
+        incremental::cell<int>& cell;
+        int& pulls;
+    };
+
+    class counted_cell_input final {
+    public:
+        explicit counted_cell_input(const counted_cell& c) noexcept
+        : cell_(&c.cell), pulls_(&c.pulls) {}
+
+        std::uint64_t pull(std::uint64_t) const noexcept {
+            ++*pulls_;
+            return cell_->version();
+        }
+
+        const int& value() const noexcept {
+            return cell_->get();
+        }
+    private:
+        const incremental::cell<int>* cell_;
+        int* pulls_;
+    };
+
+}
+
+namespace kari_hpp::detail
+{
+    template <>
+    struct incremental_input<counted_cell&> {
+        using type = counted_cell_input;
+    };
+}
+
+namespace
+{
+    struct sum_t final {
+        int operator()(int l, int r) const noexcept {
+            return l + r;
+        }
+    };
+
+    // every level has two nodes, both depend on both nodes of the level below
+    template < int Depth >
+    struct diamond final {
+        using lower_t = diamond<Depth - 1>;
+        using node_type = decltype(incremental::node(
+            sum_t{},
+            std::declval<typename lower_t::node_type&>(),
+            std::declval<typename lower_t::node_type&>()));
+
+        explicit diamond(const counted_cell& c)
+        : lower(c) {}
+
+        lower_t lower;
+        node_type lhs{incremental::node(sum_t{}, lower.lhs, lower.rhs)};
+        node_type rhs{incremental::node(sum_t{}, lower.lhs, lower.rhs)};
+    };
+
+    template <>
+    struct diamond<0> final {
+        using node_type = decltype(incremental::node(fid, std::declval<counted_cell&>()));
+
+        explicit diamond(const counted_cell& c)
+        : source(c) {}
+
+        counted_cell source;
+        node_type lhs{incremental::node(fid, source)};
+        node_type rhs{incremental::node(fid, source)};
+    };
+}
+
+TEST_CASE("kari_incremental") {
+    using namespace incremental;
+
+    SUBCASE("cells") {
+        cell<int> a{1};
+        cell<int> b{2};
+
+        int calls = 0;
+        auto sum = node([&calls](int x, int y){ ++calls; return x + y; }, a, b);
+
+        CHECK(sum.get() == 3);
+        CHECK(sum() == 3);
+        CHECK(calls == 1);
+
+        a.set(10);
+        CHECK(sum.get() == 12);
+        CHECK(calls == 2);
+
+        // the same value doesn't make the cell dirty
+        a.set(10);
+        CHECK(sum.get() == 12);
+        CHECK(calls == 2);
+
+        b.modify([](int& v){ v *= 2; });
+        CHECK(sum.get() == 14);
+        CHECK(calls == 3);
+    }
+
+    SUBCASE("constants") {
+        cell<std::string> name{"world"};
+        auto greeting = node(curry([](const std::string& h, const std::string& n){
+            return h + ", " + n;
+        }), std::string("hello"), name);
+
+        CHECK(greeting.get() == "hello, world");
+        name.set("kari");
+        CHECK(greeting.get() == "hello, kari");
+    }
+
+    SUBCASE("pipes") {
+        cell<int> a{3};
+
+        std::vector<int> calls(3);
+        const auto stage = [&calls](std::size_t i, auto f){
+            return curry([&calls, i, f](int v){ ++calls[i]; return f(v); });
+        };
+
+        auto n = node(
+            stage(0, _ / 2) | stage(1, _ + 1) | stage(2, _ * 10),
+            a);
+
+        CHECK(n.get() == 20);
+        CHECK(calls == std::vector<int>{1, 1, 1});
+
+        // 3 / 2 == 2 / 2, the change stops at the first stage
+        a.set(2);
+        CHECK(n.get() == 20);
+        CHECK(calls == std::vector<int>{2, 1, 1});
+
+        a.set(4);
+        CHECK(n.get() == 30);
+        CHECK(calls == std::vector<int>{3, 2, 2});
+
+        auto c = node((_ * 10) * (_ + 1), a);
+        CHECK(c.get() == 50);
+    }
+
+    SUBCASE("diamond") {
+        cell<int> a{1};
+
+        int calls = 0;
+        std::vector<std::pair<int, int>> seen;
+
+        auto lhs = node(_ + 1, a);
+        auto rhs = node(_ * 2, a);
+        auto sum = node([&](int x, int y){
+            ++calls;
+            seen.emplace_back(x, y);
+            return x + y;
+        }, lhs, rhs);
+
+        CHECK(sum.get() == 4);
+        a.set(5);
+        CHECK(sum.get() == 16);
+        CHECK(sum.get() == 16);
+
+        // every recompute sees both sides of the same cell value
+        CHECK(calls == 2);
+        CHECK(seen == std::vector<std::pair<int, int>>{{2, 2}, {6, 10}});
+    }
+
+    SUBCASE("deep diamond") {
+        cell<int> a{1};
+        int pulls = 0;
+
+        const auto d = std::make_unique<diamond<20>>(counted_cell{a, pulls});
+        CHECK(d->lhs.get() == (1 << 20));
+
+        // a shared node is validated once per get(), not once per path to it
+        pulls = 0;
+        CHECK(d->lhs.get() == (1 << 20));
+        CHECK(pulls == 2);
+
+        pulls = 0;
+        a.set(2);
+        CHECK(d->lhs.get() == (2 << 20));
+        CHECK(d->rhs.get() == (2 << 20));
+        CHECK(pulls == 4);
+    }
+
+    SUBCASE("separate graphs") {
+        // graphs share no state, so they can be used from different threads
+        const auto run = [](int seed, int& result, int& calls){
+            cell<int> a{seed};
+            auto twice = node([&calls](int x){ ++calls; return x * 2; }, a);
+            for ( int i = 0; i < 1000; ++i ) {
+                a.set(seed + i % 10);
+                result += twice.get();
+                result -= twice.get();
+            }
+            result = twice.get();
+        };
+
+        int result1 = 0, calls1 = 0;
+        int result2 = 0, calls2 = 0;
+        std::thread t1(run, 1, std::ref(result1), std::ref(calls1));
+        std::thread t2(run, 100, std::ref(result2), std::ref(calls2));
+        t1.join();
+        t2.join();
+
+        CHECK(result1 == 20);
+        CHECK(result2 == 218);
+        CHECK(calls1 == 1000);
+        CHECK(calls2 == 1000);
+    }
+
+    SUBCASE("exceptions") {
+        cell<int> a{1};
+        int calls = 0;
+        auto n = node([&calls](int v){
+            ++calls;
+            if ( v < 0 ) {
+                throw std::domain_error("negative");
+            }
+            return v;
+        }, a);
+
+        CHECK(n.get() == 1);
+        a.set(-1);
+        CHECK_THROWS(n.get());
+        CHECK_THROWS(n.get());
+        CHECK(calls == 3);
+        a.set(2);
+        CHECK(n.get() == 2);
+    }
+}
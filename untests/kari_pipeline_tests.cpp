@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/BlackMATov/kari.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2017-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include "kari_tests.hpp"
+
+#include <kari.hpp/kari_pipeline.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace kari_hpp;
+using namespace kari_hpp::ext;
+using namespace kari_hpp::ext::underscore;
+
+TEST_CASE("kari_pipeline") {
+    SUBCASE("stages") {
+        const auto p = (_ + 1) | (_ * 2) | (_ - 3);
+        auto s = pipeline_stream<int>(p);
+        STATIC_CHECK(std::is_same_v<decltype(s)::output_type, int>);
+
+        std::vector<int> input(10000);
+        std::iota(input.begin(), input.end(), 0);
+
+        std::vector<int> output;
+        s.run(input.begin(), input.end(), std::back_inserter(output));
+
+        REQUIRE(output.size() == input.size());
+        for ( std::size_t i = 0; i < input.size(); ++i ) {
+            REQUIRE(output[i] == p(input[i]));
+        }
+        CHECK_FALSE(s.pop());
+    }
+
+    SUBCASE("compose") {
+        auto s = pipeline_stream<int>((_ - 3) * (_ * 2) * (_ + 1));
+        s.push(10);
+        s.close();
+        CHECK(s.pop() == 19);
+        CHECK_FALSE(s.pop());
+    }
+
+    SUBCASE("types") {
+        const auto to_string = curry([](int v){ return std::to_string(v); });
+        const auto length = curry([](const std::string& v){ return v.size(); });
+
+        auto s = pipeline_stream<int, 4>(to_string | length, _ * 2);
+        STATIC_CHECK(std::is_same_v<decltype(s)::output_type, std::size_t>);
+
+        std::thread producer([&s](){
+            for ( int i = 0; i < 1000; ++i ) {
+                s.push(i);
+            }
+            s.close();
+        });
+
+        std::size_t sum = 0;
+        while ( auto v = s.pop() ) {
+            sum += *v;
+        }
+        producer.join();
+
+        // 10 * 1 + 90 * 2 + 900 * 3
+        CHECK(sum == 2 * (10 + 180 + 2700));
+    }
+
+    SUBCASE("backpressure") {
+        std::atomic<int> produced{0};
+        auto s = pipeline_stream<int, 2>(
+            curry([&produced](int v){ ++produced; return v; }));
+
+        std::thread producer([&s](){
+            for ( int i = 0; i < 100; ++i ) {
+                s.push(i);
+            }
+            s.close();
+        });
+
+        // input queue, stage and output queue hold a few items at most
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        CHECK(produced.load() <= 5);
+
+        int count = 0;
+        while ( auto v = s.pop() ) {
+            CHECK(*v == count++);
+        }
+        producer.join();
+        CHECK(count == 100);
+    }
+
+    SUBCASE("exceptions") {
+        const auto check = curry([](int v){
+            if ( v == 50 ) {
+                throw std::logic_error("50");
+            }
+            return v;
+        });
+
+        auto s = pipeline_stream<int>((_ + 0) | check | (_ + 0));
+
+        std::vector<int> input(100);
+        std::iota(input.begin(), input.end(), 0);
+
+        std::vector<int> output;
+        CHECK_THROWS(s.run(input.begin(), input.end(), std::back_inserter(output)));
+
+        REQUIRE(output.size() == 50);
+        CHECK(output.back() == 49);
+    }
+
+    SUBCASE("exceptions between pushes") {
+        const auto check = curry([](int v){
+            if ( v == 2 ) {
+                throw std::logic_error("2");
+            }
+            return v;
+        });
+
+        // a failed stage closes its output at once, pop() doesn't wait
+        // for the input to be closed
+        auto s = pipeline_stream<int>((_ * 2) | check | (_ + 1));
+
+        s.push(0);
+        CHECK(s.pop() == 1);
+
+        s.push(1);
+        CHECK_THROWS_AS(s.pop(), std::logic_error);
+
+        // the failed stream drops the next items without blocking
+        for ( int i = 0; i < 1000; ++i ) {
+            s.push(i);
+        }
+        CHECK_THROWS_AS(s.pop(), std::logic_error);
+    }
+
+    SUBCASE("destruction") {
+        auto s = pipeline_stream<int, 4>((_ + 1) | (_ + 1));
+        for ( int i = 0; i < 4; ++i ) {
+            s.push(i);
+        }
+        // the stream stops without close() and without consumed outputs
+    }
+}
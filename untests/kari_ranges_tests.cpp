@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/BlackMATov/kari.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2017-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include "kari_tests.hpp"
+
+#include <kari.hpp/kari_ranges.hpp>
+
+#if defined(__cpp_lib_ranges)
+
+#include <algorithm>
+#include <vector>
+
+using namespace kari_hpp;
+using namespace kari_hpp::ext;
+using namespace kari_hpp::ext::underscore;
+
+TEST_CASE("kari_ranges") {
+    SUBCASE("map") {
+        const std::vector<int> v{1, 2, 3, 4};
+        const auto view = v | map(_ * 2);
+
+        STATIC_CHECK(std::ranges::view<std::remove_const_t<decltype(view)>>);
+        REQUIRE(std::ranges::equal(view, std::vector<int>{2, 4, 6, 8}));
+    }
+
+    SUBCASE("filter") {
+        const std::vector<int> v{1, 5, 10, 15};
+        auto view = v | filter(_ > 4);
+
+        REQUIRE(std::ranges::equal(view, std::vector<int>{5, 10, 15}));
+    }
+
+    SUBCASE("pipeline") {
+        const std::vector<int> v{1, 5, 6, 10};
+        {
+            auto view = v | map(_ * 2) | filter(_ > 10);
+            REQUIRE(std::ranges::equal(view, std::vector<int>{12, 20}));
+        }
+        {
+            const auto closure = map(_ * 2) | filter(_ > 10) | map(_ + 1);
+            REQUIRE(std::ranges::equal(v | closure, std::vector<int>{13, 21}));
+        }
+        {
+            auto view = std::views::iota(1, 6) | map(_ * 2) | std::views::take(2);
+            REQUIRE(std::ranges::equal(view, std::vector<int>{2, 4}));
+        }
+        {
+            // a binary function maps every element to a partial application
+            auto view = std::views::iota(1, 4) | map(_ * _);
+            auto it = std::ranges::begin(view);
+            REQUIRE((*it)(10) == 10);
+            REQUIRE((*++it)(10) == 20);
+            REQUIRE((*++it)(10) == 30);
+        }
+    }
+
+    SUBCASE("laziness") {
+        int calls = 0;
+        const auto counted = curry([&calls](int i){
+            ++calls;
+            return i * 2;
+        });
+
+        const std::vector<int> v{1, 2, 3, 4};
+        auto view = v | map(counted);
+        REQUIRE(calls == 0);
+
+        REQUIRE(*view.begin() == 2);
+        REQUIRE(calls == 1);
+    }
+
+    SUBCASE("curried functions") {
+        const auto add3 = curry([](int a, int b, int c){
+            return a + b + c;
+        });
+
+        const std::vector<int> v{1, 2, 3};
+        REQUIRE(std::ranges::equal(v | map(add3(10, 20)), std::vector<int>{31, 32, 33}));
+    }
+
+    SUBCASE("existing pipe operator") {
+        const std::vector<int> v{1, 2, 3};
+        const auto size = curry([](const std::vector<int>& c){
+            return c.size();
+        });
+        REQUIRE((v | size) == 3);
+    }
+}
+
+#endif
@@ -0,0 +1,122 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/BlackMATov/kari.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2017-2025, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include "kari_tests.hpp"
+
+#include <kari.hpp/kari_sort.hpp>
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace kari_hpp;
+using namespace kari_hpp::ext;
+using namespace kari_hpp::ext::underscore;
+
+namespace
+{
+    struct person final {
+        std::string name;
+        int age;
+    };
+
+    std::vector<std::string> names_of(const std::vector<person>& people) {
+        std::vector<std::string> names;
+        for ( const person& p : people ) {
+            names.push_back(p.name);
+        }
+        return names;
+    }
+}
+
+TEST_CASE("kari_sort") {
+    SUBCASE("fsort_by") {
+        std::vector<person> people{
+            {"carol", 35}, {"alice", 30}, {"dave", 20}, {"bob", 25}};
+
+        const auto it = fsort_by(curry(&person::age), _ < _, std::ref(people));
+        CHECK(it == people.end());
+        CHECK(names_of(people) == std::vector<std::string>{"dave", "bob", "alice", "carol"});
+
+        fsort_by(curry(&person::name), _ > _, std::ref(people));
+        CHECK(names_of(people) == std::vector<std::string>{"dave", "carol", "bob", "alice"});
+
+        const auto by_name_length = fsort_by(curry(&person::name) | curry(&std::string::size), _ < _);
+        by_name_length(std::ref(people));
+        CHECK(people.front().name == "bob");
+        CHECK(people.back().name.size() == 5);
+        CHECK(std::is_sorted(people.begin(), people.end(), [](const person& l, const person& r){
+            return l.name.size() < r.name.size();
+        }));
+    }
+
+    SUBCASE("fsort_by projections") {
+        // the projection is called exactly once per element
+        int projections = 0;
+        const auto key_of = curry([&projections](int v){
+            ++projections;
+            return v % 10;
+        });
+
+        std::vector<int> v(1000);
+        for ( std::size_t i = 0; i < v.size(); ++i ) {
+            v[i] = static_cast<int>((i * 7919) % 1000);
+        }
+
+        fsort_by(key_of, _ < _, std::ref(v));
+        CHECK(projections == 1000);
+        CHECK(std::is_sorted(v.begin(), v.end(), [](int l, int r){
+            return l % 10 < r % 10;
+        }));
+
+        std::vector<int> sorted = v;
+        std::sort(sorted.begin(), sorted.end());
+        std::sort(v.begin(), v.end());
+        CHECK(v == sorted);
+    }
+
+    SUBCASE("fsort_by move only") {
+        std::array<std::unique_ptr<int>, 5> ptrs{
+            std::make_unique<int>(3), std::make_unique<int>(1), std::make_unique<int>(4),
+            std::make_unique<int>(1), std::make_unique<int>(5)};
+
+        fsort_by(curry([](const std::unique_ptr<int>& p){ return *p; }), _ < _, std::ref(ptrs));
+        CHECK(*ptrs[0] == 1);
+        CHECK(*ptrs[1] == 1);
+        CHECK(*ptrs[2] == 3);
+        CHECK(*ptrs[3] == 4);
+        CHECK(*ptrs[4] == 5);
+    }
+
+    SUBCASE("fsort_by empty") {
+        std::vector<person> people;
+        CHECK(fsort_by(curry(&person::age), _ < _, std::ref(people)) == people.end());
+        CHECK(fpartition_by(curry(&person::age), _ < 18, std::ref(people)) == people.end());
+    }
+
+    SUBCASE("fpartition_by") {
+        std::vector<person> people{
+            {"alice", 30}, {"bob", 12}, {"carol", 45}, {"dave", 8}, {"eve", 17}};
+
+        int projections = 0;
+        const auto age_of = curry([&projections](const person& p){
+            ++projections;
+            return p.age;
+        });
+
+        const auto it = fpartition_by(age_of, _ < 18, std::ref(people));
+        CHECK(projections == 5);
+        CHECK(it == people.begin() + 3);
+        CHECK(names_of(people) == std::vector<std::string>{"bob", "dave", "eve", "alice", "carol"});
+
+        const auto adults_first = fpartition_by(curry(&person::age), _ >= 18);
+        CHECK(adults_first(std::ref(people)) == people.begin() + 2);
+        CHECK(names_of(people) == std::vector<std::string>{"alice", "carol", "bob", "dave", "eve"});
+    }
+}
@@ -7,6 +7,8 @@
 #include "kari_tests.hpp"
 
 #include <functional>
+#include <memory>
+#include <string>
 
 using namespace kari_hpp;
 
@@ -481,5 +483,185 @@ TEST_CASE("kari") {
         })(box(1),box(2))(box(3));
 
         STATIC_CHECK(b.v_ == 6);
+
+        {
+            // a move-only lvalue saturates a const partial closure
+            const auto c = curry([](int v1, const std::unique_ptr<int>& v2){
+                return v1 + *v2;
+            })(1);
+            const auto p = std::make_unique<int>(2);
+            CHECK(c(p) == 3);
+        }
+        {
+            // const and non-const partial closures pass bound arguments the same way
+            struct overloaded final {
+                int operator()(std::string&&, int) const { return 1; }
+                int operator()(const std::string&, int) const { return 2; }
+            };
+
+            const auto c = curry(overloaded{}, std::string("a"));
+            const int r = c(1);
+            CHECK(r == 1);
+            CHECK(r == std::decay_t<decltype(c)>(c)(1));
+
+            const auto g = curry([](auto&& s, int){
+                return std::is_const_v<std::remove_reference_t<decltype(s)>>;
+            }, std::string("a"));
+            CHECK(g(1) == std::decay_t<decltype(g)>(g)(1));
+        }
+    }
+
+    SUBCASE("noexcept") {
+        struct throwing_box final {
+            int v_;
+            constexpr throwing_box(int v)
+            : v_(v) {}
+
+            throwing_box(throwing_box&& other) noexcept(false)
+            : v_(other.v_) {}
+
+            throwing_box(const throwing_box& other) noexcept(false)
+            : v_(other.v_) {}
+        };
+        {
+            constexpr auto l = [](int a, int b) noexcept {
+                return a + b;
+            };
+
+            using c0_t = decltype(curry(l));
+            using c1_t = decltype(curry(l, 1));
+
+            STATIC_CHECK(noexcept(curry(l)));
+            STATIC_CHECK(noexcept(curry(l, 1)));
+            STATIC_CHECK(noexcept(curry(l, 1, 2)));
+            STATIC_CHECK(noexcept(std::declval<const c0_t&>()(1)));
+            STATIC_CHECK(noexcept(std::declval<const c0_t&>()(1, 2)));
+            STATIC_CHECK(noexcept(std::declval<c1_t&&>()(2)));
+
+            STATIC_CHECK(std::is_nothrow_copy_constructible_v<c1_t>);
+            STATIC_CHECK(std::is_nothrow_move_constructible_v<c1_t>);
+        }
+        {
+            constexpr auto l = [](int a, int b) {
+                return a + b;
+            };
+
+            STATIC_CHECK(noexcept(curry(l, 1)));
+            STATIC_CHECK_FALSE(noexcept(curry(l, 1, 2)));
+        }
+        {
+            constexpr auto l = [](const throwing_box& a, int b) noexcept {
+                return a.v_ + b;
+            };
+
+            using c0_t = decltype(curry(l));
+            using c1_t = decltype(curry(l, throwing_box(1)));
+
+            STATIC_CHECK_FALSE(noexcept(curry(l, throwing_box(1))));
+            STATIC_CHECK_FALSE(noexcept(std::declval<const c0_t&>()(throwing_box(1))));
+            STATIC_CHECK(noexcept(std::declval<const c1_t&>()(2)));
+
+            STATIC_CHECK_FALSE(std::is_nothrow_copy_constructible_v<c1_t>);
+            STATIC_CHECK_FALSE(std::is_nothrow_move_constructible_v<c1_t>);
+        }
+        {
+            constexpr auto l = [](const throwing_box& a, int b, int c) noexcept {
+                return a.v_ + b + c;
+            };
+
+            using c1_t = decltype(curry(l, throwing_box(1)));
+
+            STATIC_CHECK_FALSE(noexcept(std::declval<const c1_t&>()(2)));
+            STATIC_CHECK_FALSE(noexcept(std::declval<const c1_t&>()(2, 3)));
+        }
+    }
+
+    SUBCASE("trivially copyable") {
+        struct box final {
+            int v_;
+        };
+
+        struct non_trivial_box final {
+            int v_;
+            non_trivial_box(int v)
+            : v_(v) {}
+            non_trivial_box(const non_trivial_box& other)
+            : v_(other.v_) {}
+        };
+        {
+            constexpr auto l = [](auto a, auto b, auto c){
+                return a + b + c;
+            };
+
+            using c0_t = decltype(curry(l));
+            using c1_t = decltype(curry(l, 1));
+            using c2_t = decltype(curry(l, 1, 2.f));
+            using c3_t = decltype(curry(l, box{1}));
+
+            STATIC_CHECK(std::is_trivially_copyable_v<c0_t>);
+            STATIC_CHECK(std::is_trivially_copyable_v<c1_t>);
+            STATIC_CHECK(std::is_trivially_copyable_v<c2_t>);
+            STATIC_CHECK(std::is_trivially_copyable_v<c3_t>);
+        }
+        {
+            int i = 42;
+            const auto l = [i](int& a, int b){
+                return a + b + i;
+            };
+
+            using c1_t = decltype(curry(l, std::ref(i)));
+
+            STATIC_CHECK(std::is_trivially_copyable_v<decltype(l)>);
+            STATIC_CHECK(std::is_trivially_copyable_v<c1_t>);
+        }
+        {
+            constexpr auto l = [](auto a, auto b){
+                return a.v_ + b;
+            };
+
+            using c1_t = decltype(curry(l, non_trivial_box(1)));
+
+            STATIC_CHECK_FALSE(std::is_trivially_copyable_v<c1_t>);
+        }
+    }
+
+    SUBCASE("normalized args") {
+        using detail::normalized_arg_type;
+        {
+            constexpr auto l = [](long a, const double& b, int* c){
+                return a + static_cast<long>(b) + *c;
+            };
+            using l_t = std::decay_t<decltype(l)>;
+
+            STATIC_CHECK(std::is_same_v<normalized_arg_type<l_t, 0, short>::type, long>);
+            STATIC_CHECK(std::is_same_v<normalized_arg_type<l_t, 0, const int&>::type, long>);
+            STATIC_CHECK(std::is_same_v<normalized_arg_type<l_t, 1, float>::type, float>);
+            STATIC_CHECK(std::is_same_v<normalized_arg_type<l_t, 2, int*>::type, int*>);
+            STATIC_CHECK(std::is_same_v<normalized_arg_type<l_t, 2, std::nullptr_t>::type, int*>);
+            STATIC_CHECK(std::is_same_v<normalized_arg_type<l_t, 3, short>::type, short>);
+
+        #if KARI_HPP_NORMALIZE_ARGS
+            STATIC_CHECK(std::is_same_v<decltype(curry(l, short(1))), decltype(curry(l, 1L))>);
+        #endif
+
+            int i = 3;
+            CHECK(curry(l, short(1))(2.5, &i) == 6);
+            CHECK(curry(l, 'a', 2.5)(&i) == 102);
+        }
+        {
+            constexpr auto g = [](auto a, int b){
+                return a + b;
+            };
+            using g_t = std::decay_t<decltype(g)>;
+
+            STATIC_CHECK(std::is_same_v<normalized_arg_type<g_t, 0, short>::type, short>);
+            STATIC_CHECK(std::is_same_v<normalized_arg_type<g_t, 1, short>::type, short>);
+        }
+        {
+            using f_t = int(*)(int, int&);
+
+            STATIC_CHECK(std::is_same_v<normalized_arg_type<f_t, 0, char>::type, int>);
+            STATIC_CHECK(std::is_same_v<normalized_arg_type<f_t, 1, std::reference_wrapper<int>>::type, int&>);
+        }
     }
 }